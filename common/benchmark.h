@@ -0,0 +1,372 @@
+#ifndef COMMON_BENCHMARK_H
+#define COMMON_BENCHMARK_H
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "system_timer.h"
+
+// Keep value alive as if it were read, so the computation producing it is not removed
+// 값을 읽는 것처럼 유지하여, 그 값을 만드는 계산이 제거되지 않게 함
+template<typename T>
+inline void doNotOptimize(const T& value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+// Same for a value the compiler must also assume was modified
+// Compiler가 값이 수정되었다고도 가정해야 하는 경우
+template<typename T>
+inline void doNotOptimize(T& value) {
+    asm volatile("" : "+m,r"(value) : : "memory");
+}
+
+// Force pending stores to memory and forget what memory holds
+// 대기 중인 store를 memory에 반영하고 memory 내용에 대한 가정을 버림
+inline void clobberMemory() {
+    asm volatile("" : : : "memory");
+}
+
+// How long and how often each benchmark runs
+// 각 벤치마크를 얼마나 오래, 몇 번 실행할지
+struct BenchmarkOptions {
+    std::chrono::nanoseconds warmup = std::chrono::milliseconds(50);         // Untimed runs first
+                                                                             // 먼저 측정하지 않고 실행
+    std::chrono::nanoseconds minSampleTime = std::chrono::milliseconds(10);  // Each sample lasts at least this
+                                                                             // 각 sample의 최소 시간
+    int samples = 30;
+    std::uint64_t maxIterations = std::uint64_t(1) << 32;                    // Per sample
+                                                                             // Sample당
+};
+
+enum class ReportFormat {
+    Table,
+    Csv,
+    Json,
+};
+
+// Statistics of one benchmark; times are nanoseconds per item
+// 벤치마크 하나의 통계; 시간은 item당 나노초
+struct BenchmarkResult {
+    std::string group;
+    std::string name;
+    double itemsPerIteration;
+    std::uint64_t iterations; // Per sample
+                              // Sample당
+    int samples;
+    double min;
+    double median;
+    double mean;
+    double p99;
+    double max;
+    double stddev;
+
+    double itemsPerSec() const {
+        return median > 0.0 ? 1e9 / median : 0.0;
+    }
+};
+
+// Statistical micro-benchmark harness
+// 통계적 micro-benchmark harness
+//
+// run(name, body) calls body() repeatedly. It first warms up for
+// options.warmup, then doubles (or more) the iteration count until one sample
+// takes at least options.minSampleTime, then times options.samples samples of
+// that many iterations. Each sample gives nanoseconds per item (an iteration
+// may process itemsPerIteration items), and the samples give min, median,
+// mean, p99, max and standard deviation. The clock is SystemTimer<TimePolicy>,
+// so any policy with getNanoseconds() works; initialize it first if it needs
+// it (TscTimePolicy).
+// run(name, body)는 body()를 반복 호출함. 먼저 options.warmup 동안 warm-up하고, sample
+// 하나가 options.minSampleTime 이상 걸릴 때까지 반복 횟수를 두 배 (또는 그 이상)로 늘린
+// 뒤, 그 횟수로 options.samples개의 sample을 측정함. 각 sample은 item당 나노초를 주며
+// (한 iteration은 itemsPerIteration개의 item을 처리할 수 있음), sample들로 min, median,
+// mean, p99, max, 표준편차를 구함. Clock은 SystemTimer<TimePolicy>이므로
+// getNanoseconds()를 가진 모든 policy를 사용할 수 있음; 초기화가 필요한 policy
+// (TscTimePolicy)는 먼저 초기화해야 함.
+//
+// Table rows are printed as each benchmark finishes; CSV and JSON are written
+// by report(). fromArgs() understands --format=table|csv|json,
+// --output=<file>, --samples=<n>, --min-time=<ms> and --warmup=<ms>.
+// Table 행은 각 벤치마크가 끝날 때 출력되며, CSV와 JSON은 report()가 기록함.
+// fromArgs()는 --format=table|csv|json, --output=<file>, --samples=<n>,
+// --min-time=<ms>, --warmup=<ms>를 인식함.
+template<typename TimePolicy = NanosecondTimePolicy>
+class Benchmark {
+public:
+    static_assert(SystemTimer<TimePolicy>::kHighResolution, "Benchmark needs a TimePolicy with getNanoseconds()");
+
+    explicit Benchmark(BenchmarkOptions defaults = BenchmarkOptions(), ReportFormat reportFormat = ReportFormat::Table,
+                       std::ostream& output = std::cout)
+        : options(defaults), format(reportFormat), out(&output) {}
+
+    // Build from command-line options; recognized options are removed from argv
+    // Command-line option으로 생성; 인식한 option은 argv에서 제거됨
+    static Benchmark fromArgs(int& argc, char** argv) {
+        Benchmark bench;
+        int kept = 1;
+        for (int i = 1; i < argc; ++i) {
+            const char* arg = argv[i];
+            if (std::strcmp(arg, "--format=csv") == 0) {
+                bench.format = ReportFormat::Csv;
+            } else if (std::strcmp(arg, "--format=json") == 0) {
+                bench.format = ReportFormat::Json;
+            } else if (std::strcmp(arg, "--format=table") == 0) {
+                bench.format = ReportFormat::Table;
+            } else if (std::strncmp(arg, "--output=", 9) == 0) {
+                bench.file = std::make_unique<std::ofstream>(arg + 9);
+                bench.out = bench.file.get();
+            } else if (std::strncmp(arg, "--samples=", 10) == 0) {
+                bench.options.samples = std::max(1, std::atoi(arg + 10));
+            } else if (std::strncmp(arg, "--min-time=", 11) == 0) {
+                bench.options.minSampleTime = std::chrono::milliseconds(std::atoi(arg + 11));
+            } else if (std::strncmp(arg, "--warmup=", 9) == 0) {
+                bench.options.warmup = std::chrono::milliseconds(std::atoi(arg + 9));
+            } else {
+                argv[kept++] = argv[i];
+            }
+        }
+        argc = kept;
+        argv[argc] = nullptr;
+        return bench;
+    }
+
+    // Start a named group of benchmarks (a heading in the table)
+    // 이름 있는 벤치마크 group 시작 (table의 제목)
+    void section(const std::string& title) {
+        group = title;
+        if (format == ReportFormat::Table) {
+            *out << "\n" << title << "\n";
+            printHeader();
+        }
+    }
+
+    // Free-form note printed in table mode only
+    // Table mode에서만 출력되는 자유 형식 메모
+    void note(const std::string& text) {
+        if (format == ReportFormat::Table) {
+            *out << text << std::endl;
+        }
+    }
+
+    // Note how many times faster result is than baseline, by median
+    // result가 baseline보다 몇 배 빠른지 median 기준으로 메모
+    void noteSpeedup(const BenchmarkResult& baseline, const BenchmarkResult& result) {
+        std::ostringstream line;
+        line << std::fixed << std::setprecision(1) << "    " << result.name << ": " << baseline.median / result.median
+             << "x " << baseline.name;
+        note(line.str());
+    }
+
+    // Note the median rate of result in millions of items per second, e.g. "M updates/s"
+    // result의 median 처리율을 초당 백만 item 단위로 메모, 예: "M updates/s"
+    void noteRate(const BenchmarkResult& result, const std::string& items) {
+        std::ostringstream line;
+        line << std::fixed << std::setprecision(0) << "    " << result.name << ": " << result.itemsPerSec() / 1e6 << "M " << items
+             << "/s";
+        note(line.str());
+    }
+
+    template<typename Body>
+    BenchmarkResult run(const std::string& name, Body&& body, double itemsPerIteration = 1.0) {
+        return run(name, options, std::forward<Body>(body), itemsPerIteration);
+    }
+
+    // Run with options other than the harness defaults, e.g. fewer samples for slow bodies
+    // Harness 기본값과 다른 option으로 실행, 예: 느린 body에는 더 적은 sample
+    template<typename Body>
+    BenchmarkResult run(const std::string& name, const BenchmarkOptions& runOptions, Body&& body,
+                        double itemsPerIteration = 1.0) {
+        // Warm-up: caches, branch predictors, page faults, CPU frequency
+        // Warm-up: cache, branch predictor, page fault, CPU 주파수
+        std::uint64_t warmupEnd = now() + static_cast<std::uint64_t>(runOptions.warmup.count());
+        do {
+            body();
+        } while (now() < warmupEnd);
+
+        // Find an iteration count that makes one sample long enough to time
+        // Sample 하나가 측정하기에 충분히 길어지는 반복 횟수를 찾음
+        const double target = static_cast<double>(runOptions.minSampleTime.count());
+        std::uint64_t iterations = 1;
+        while (iterations < runOptions.maxIterations) {
+            double elapsed = static_cast<double>(timeIterations(body, iterations));
+            if (elapsed >= target) {
+                break;
+            }
+            double factor = elapsed > 0.0 ? target * 1.2 / elapsed : 100.0;
+            factor = std::min(100.0, std::max(2.0, factor));
+            iterations = std::min(runOptions.maxIterations,
+                                  static_cast<std::uint64_t>(static_cast<double>(iterations) * factor));
+        }
+
+        std::vector<double> perItem(static_cast<std::size_t>(std::max(1, runOptions.samples)));
+        for (double& sample : perItem) {
+            double elapsed = static_cast<double>(timeIterations(body, iterations));
+            sample = elapsed / (static_cast<double>(iterations) * itemsPerIteration);
+        }
+
+        results.push_back(summarize(name, itemsPerIteration, iterations, perItem));
+        if (format == ReportFormat::Table) {
+            if (!headerPrinted) {
+                printHeader();
+            }
+            printRow(results.back());
+        }
+        return results.back();
+    }
+
+    // Write CSV or JSON output (tables are already printed)
+    // CSV 또는 JSON 출력을 기록 (table은 이미 출력됨)
+    void report() {
+        if (format == ReportFormat::Csv) {
+            *out << "group,name,samples,iterations,items_per_iteration,"
+                    "min_ns,median_ns,mean_ns,p99_ns,max_ns,stddev_ns,items_per_sec\n";
+            for (const BenchmarkResult& r : results) {
+                *out << csvField(r.group) << ',' << csvField(r.name) << ',' << r.samples << ',' << r.iterations
+                     << ',' << r.itemsPerIteration << ',' << r.min << ',' << r.median << ',' << r.mean << ','
+                     << r.p99 << ',' << r.max << ',' << r.stddev << ',' << r.itemsPerSec() << '\n';
+            }
+        } else if (format == ReportFormat::Json) {
+            *out << "{\n  \"benchmarks\": [\n";
+            for (std::size_t i = 0; i < results.size(); ++i) {
+                const BenchmarkResult& r = results[i];
+                *out << "    {\"group\": " << jsonString(r.group) << ", \"name\": " << jsonString(r.name)
+                     << ", \"samples\": " << r.samples << ", \"iterations\": " << r.iterations
+                     << ", \"items_per_iteration\": " << r.itemsPerIteration << ", \"min_ns\": " << r.min
+                     << ", \"median_ns\": " << r.median << ", \"mean_ns\": " << r.mean << ", \"p99_ns\": " << r.p99
+                     << ", \"max_ns\": " << r.max << ", \"stddev_ns\": " << r.stddev
+                     << ", \"items_per_sec\": " << r.itemsPerSec() << "}" << (i + 1 < results.size() ? "," : "")
+                     << "\n";
+            }
+            *out << "  ]\n}\n";
+        }
+        out->flush();
+    }
+
+    // Options run() uses when none are given; start from these to override a few
+    // Option 없이 run()이 사용하는 option; 일부만 바꿀 때 여기서 시작
+    const BenchmarkOptions& defaults() const {
+        return options;
+    }
+
+    ReportFormat reportFormat() const {
+        return format;
+    }
+
+    const std::vector<BenchmarkResult>& allResults() const {
+        return results;
+    }
+
+private:
+    BenchmarkOptions options;
+    ReportFormat format;
+    std::ostream* out;
+    std::unique_ptr<std::ofstream> file;
+    std::string group;
+    bool headerPrinted = false;
+    std::vector<BenchmarkResult> results;
+
+    static std::uint64_t now() {
+        return SystemTimer<TimePolicy>::nanos();
+    }
+
+    template<typename Body>
+    static std::uint64_t timeIterations(Body& body, std::uint64_t iterations) {
+        std::uint64_t start = now();
+        for (std::uint64_t i = 0; i < iterations; ++i) {
+            body();
+        }
+        return now() - start;
+    }
+
+    BenchmarkResult summarize(const std::string& name, double items, std::uint64_t iterations,
+                              std::vector<double>& samples) const {
+        std::sort(samples.begin(), samples.end());
+        auto at = [&samples](double q) {
+            double position = q * static_cast<double>(samples.size() - 1);
+            std::size_t lower = static_cast<std::size_t>(position);
+            std::size_t upper = std::min(lower + 1, samples.size() - 1);
+            return samples[lower] + (samples[upper] - samples[lower]) * (position - static_cast<double>(lower));
+        };
+
+        double sum = 0.0;
+        for (double s : samples) {
+            sum += s;
+        }
+        double mean = sum / static_cast<double>(samples.size());
+        double squares = 0.0;
+        for (double s : samples) {
+            squares += (s - mean) * (s - mean);
+        }
+
+        BenchmarkResult result;
+        result.group = group;
+        result.name = name;
+        result.itemsPerIteration = items;
+        result.iterations = iterations;
+        result.samples = static_cast<int>(samples.size());
+        result.min = samples.front();
+        result.median = at(0.5);
+        result.mean = mean;
+        result.p99 = at(0.99);
+        result.max = samples.back();
+        result.stddev = samples.size() > 1 ? std::sqrt(squares / static_cast<double>(samples.size() - 1)) : 0.0;
+        return result;
+    }
+
+    // CSV field: quotes are doubled
+    // CSV field: 따옴표는 두 번 씀
+    static std::string csvField(const std::string& text) {
+        std::string result = "\"";
+        for (char c : text) {
+            result += c;
+            if (c == '"') {
+                result += '"';
+            }
+        }
+        return result + "\"";
+    }
+
+    // JSON string: quotes and backslashes are escaped
+    // JSON string: 따옴표와 backslash는 escape됨
+    static std::string jsonString(const std::string& text) {
+        std::string result = "\"";
+        for (char c : text) {
+            if (c == '"' || c == '\\') {
+                result += '\\';
+            }
+            result += c;
+        }
+        return result + "\"";
+    }
+
+    void printHeader() {
+        headerPrinted = true;
+        *out << std::left << std::setw(36) << "benchmark" << std::right << std::setw(12) << "min ns"
+             << std::setw(12) << "median ns" << std::setw(12) << "p99 ns" << std::setw(10) << "stddev"
+             << std::setw(14) << "Mitems/s" << "  samples x iterations" << std::endl;
+    }
+
+    void printRow(const BenchmarkResult& r) {
+        *out << std::left << std::setw(36) << r.name << std::right << std::fixed << std::setprecision(2)
+             << std::setw(12) << r.min << std::setw(12) << r.median << std::setw(12) << r.p99
+             << std::setw(9) << (r.median > 0.0 ? r.stddev / r.median * 100.0 : 0.0) << "%"
+             << std::setw(14) << r.itemsPerSec() / 1e6 << "  " << r.samples << " x " << r.iterations
+             << std::endl;
+        out->unsetf(std::ios::fixed);
+    }
+};
+
+#endif // COMMON_BENCHMARK_H
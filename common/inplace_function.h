@@ -0,0 +1,200 @@
+#ifndef COMMON_INPLACE_FUNCTION_H
+#define COMMON_INPLACE_FUNCTION_H
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+template<typename Signature, std::size_t Capacity = 32>
+class InplaceFunction;
+
+// Move-only callable stored in a fixed buffer inside the object
+// 객체 안의 고정된 buffer에 저장되는 move-only callable
+//
+// std::function allocates when the callable does not fit its small internal
+// buffer, which is implementation-defined and usually two pointers, and it
+// must be copyable. InplaceFunction never allocates: a callable larger than
+// Capacity bytes is a compile error, not a heap fallback. It also accepts
+// move-only callables, e.g. a lambda that owns a std::unique_ptr. A call
+// loads one function pointer stored next to the buffer and calls it, like a
+// plain function pointer. Calling an empty InplaceFunction throws
+// std::bad_function_call.
+// std::function은 callable이 작은 내부 buffer (구현마다 다르며 보통 pointer 두 개)에
+// 들어가지 않으면 할당하며, callable이 복사 가능해야 함. InplaceFunction은 할당하지
+// 않음: Capacity byte보다 큰 callable은 heap으로 대체되지 않고 compile error가 됨.
+// 또한 std::unique_ptr를 소유한 lambda처럼 move-only callable도 받음. 호출은 buffer 옆에
+// 저장된 function pointer 하나를 읽어 호출하며, 일반 function pointer와 같음. 빈
+// InplaceFunction을 호출하면 std::bad_function_call을 throw함.
+template<typename R, typename... Args, std::size_t Capacity>
+class InplaceFunction<R(Args...), Capacity> {
+public:
+    InplaceFunction() noexcept = default;
+
+    InplaceFunction(std::nullptr_t) noexcept {
+    }
+
+    template<typename F,
+             typename T = std::decay_t<F>,
+             typename = std::enable_if_t<!std::is_same_v<T, InplaceFunction> && std::is_invocable_r_v<R, T&, Args...>>>
+    InplaceFunction(F&& f) {
+        static_assert(sizeof(T) <= Capacity, "Callable does not fit; raise the Capacity of InplaceFunction");
+        static_assert(alignof(T) <= alignof(std::max_align_t), "Callable is over-aligned for InplaceFunction");
+        static_assert(std::is_nothrow_move_constructible_v<T>, "Callable must be nothrow move constructible");
+        if constexpr (std::is_pointer_v<T> || std::is_member_pointer_v<T>) {
+            if (f == nullptr) {
+                return; // A null function pointer leaves the object empty, like std::function
+                        // Null function pointer는 std::function처럼 객체를 비워 둠
+            }
+        }
+        ::new (static_cast<void*>(storage)) T(std::forward<F>(f));
+        invoker = &invoke<T>;
+        manager = &manage<T>;
+    }
+
+    InplaceFunction(InplaceFunction&& other) noexcept {
+        moveFrom(other);
+    }
+
+    InplaceFunction& operator=(InplaceFunction&& other) noexcept {
+        if (this != &other) {
+            reset();
+            moveFrom(other);
+        }
+        return *this;
+    }
+
+    InplaceFunction& operator=(std::nullptr_t) noexcept {
+        reset();
+        return *this;
+    }
+
+    InplaceFunction(const InplaceFunction&) = delete;
+    InplaceFunction& operator=(const InplaceFunction&) = delete;
+
+    ~InplaceFunction() {
+        reset();
+    }
+
+    explicit operator bool() const noexcept {
+        return manager != nullptr;
+    }
+
+    // Const like std::function::operator(); the stored callable itself may change state
+    // std::function::operator()처럼 const; 저장된 callable 자체는 상태를 바꿀 수 있음
+    R operator()(Args... args) const {
+        return invoker(storage, std::forward<Args>(args)...);
+    }
+
+private:
+    enum class Operation { Move, Destroy };
+
+    using Invoker = R (*)(void*, Args&&...);
+    using Manager = void (*)(Operation, void* self, void* target) noexcept;
+
+    alignas(std::max_align_t) mutable unsigned char storage[Capacity];
+    Invoker invoker = &invokeEmpty;
+    Manager manager = nullptr;
+
+    template<typename T>
+    static R invoke(void* self, Args&&... args) {
+        return std::invoke(*static_cast<T*>(self), std::forward<Args>(args)...);
+    }
+
+    static R invokeEmpty(void*, Args&&...) {
+        throw std::bad_function_call();
+    }
+
+    // Move constructs into target, or destroys self
+    // target으로 move 생성하거나, self를 파괴
+    template<typename T>
+    static void manage(Operation operation, void* self, void* target) noexcept {
+        T* callable = static_cast<T*>(self);
+        if (operation == Operation::Move) {
+            ::new (target) T(std::move(*callable));
+        }
+        callable->~T();
+    }
+
+    void moveFrom(InplaceFunction& other) noexcept {
+        if (other.manager != nullptr) {
+            other.manager(Operation::Move, other.storage, storage);
+            invoker = other.invoker;
+            manager = other.manager;
+            other.invoker = &invokeEmpty;
+            other.manager = nullptr;
+        }
+    }
+
+    void reset() noexcept {
+        if (manager != nullptr) {
+            manager(Operation::Destroy, storage, nullptr);
+            invoker = &invokeEmpty;
+            manager = nullptr;
+        }
+    }
+};
+
+template<typename Signature>
+class FunctionRef;
+
+// Non-owning reference to a callable, two pointers wide
+// Callable에 대한 소유하지 않는 참조, pointer 두 개 크기
+//
+// For parameters that only call the callable during the call, where
+// std::function would copy it and maybe allocate. The callable must outlive
+// the FunctionRef, so do not keep one built from a temporary lambda. A plain
+// function or function pointer is stored by value, so it has no such limit.
+// 호출되는 동안에만 callable을 호출하는 parameter용이며, 이런 경우 std::function은
+// callable을 복사하고 할당할 수도 있음. Callable은 FunctionRef보다 오래 살아야 하므로,
+// 임시 lambda로 만든 FunctionRef를 보관하지 말 것. 일반 함수나 function pointer는 값으로
+// 저장되므로 이런 제한이 없음.
+template<typename R, typename... Args>
+class FunctionRef<R(Args...)> {
+public:
+    template<typename F,
+             typename T = std::remove_reference_t<F>,
+             typename = std::enable_if_t<!std::is_same_v<std::remove_cv_t<T>, FunctionRef> &&
+                                         !std::is_function_v<T> &&
+                                         !std::is_function_v<std::remove_pointer_t<std::remove_cv_t<T>>> &&
+                                         std::is_invocable_r_v<R, T&, Args...>>>
+    FunctionRef(F&& f) noexcept : invoker(&invokeObject<T>) {
+        target.object = const_cast<void*>(static_cast<const void*>(std::addressof(f)));
+    }
+
+    // A function, or a pointer to one; the pointer itself is kept, not its address
+    // 함수 또는 function pointer; pointer의 주소가 아니라 pointer 자체를 보관함
+    template<typename F, typename = std::enable_if_t<std::is_function_v<F> && std::is_invocable_r_v<R, F*, Args...>>>
+    FunctionRef(F* f) noexcept : invoker(&invokeFunction<F>) {
+        target.function = reinterpret_cast<void (*)()>(f);
+    }
+
+    R operator()(Args... args) const {
+        return invoker(target, std::forward<Args>(args)...);
+    }
+
+private:
+    // An object pointer and a function pointer may differ in size, so keep either
+    // Object pointer와 function pointer는 크기가 다를 수 있으므로 둘 중 하나를 보관
+    union Target {
+        void* object;
+        void (*function)();
+    };
+
+    Target target;
+    R (*invoker)(Target, Args&&...);
+
+    template<typename T>
+    static R invokeObject(Target target, Args&&... args) {
+        return std::invoke(*static_cast<T*>(target.object), std::forward<Args>(args)...);
+    }
+
+    template<typename F>
+    static R invokeFunction(Target target, Args&&... args) {
+        return std::invoke(reinterpret_cast<F*>(target.function), std::forward<Args>(args)...);
+    }
+};
+
+#endif // COMMON_INPLACE_FUNCTION_H
@@ -0,0 +1,480 @@
+#ifndef COMMON_INSTRUMENT_H
+#define COMMON_INSTRUMENT_H
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "system_timer.h"
+
+// What a call site records
+// 호출 지점이 기록하는 내용
+enum class SiteKind : std::uint8_t {
+    Scope,   // Duration of a block, plus a trace event
+             // Block의 실행 시간과 trace event
+    Counter, // Sum of the deltas
+             // Delta의 합
+    Value,   // Histogram of recorded values
+             // 기록한 값의 histogram
+};
+
+// Hot-path instrumentation: scope timers, counters and histograms
+// Hot path 계측: scope timer, counter, histogram
+//
+// Each thread writes to its own buffer, so recording never takes a lock or
+// an atomic read-modify-write: the owner thread stores new totals with
+// relaxed atomics, and readers sum every buffer on the side. Buffers are
+// linked into a lock-free list the first time a thread records and are kept
+// until the program exits, so threads that have finished still show up in
+// the totals. Scopes also append a trace event, up to kEventsPerThread per
+// thread; later events are counted as dropped, while the scope's histogram
+// keeps counting. Nothing is recorded until enable() is called. After its
+// first run, a disabled call site costs the guard check of its function-local
+// static Site (a load and a branch) plus one relaxed load and a branch. Define
+// INSTRUMENT_DISABLED to compile the macros out entirely.
+// 각 thread는 자신의 buffer에 기록하므로, 기록할 때 lock이나 atomic read-modify-write가
+// 필요 없음: 소유 thread가 relaxed atomic으로 새 합계를 저장하고, reader는 별도로 모든
+// buffer를 합산함. Buffer는 thread가 처음 기록할 때 lock-free list에 연결되며 program이
+// 끝날 때까지 유지되므로, 이미 끝난 thread도 합계에 포함됨. Scope는 thread마다
+// kEventsPerThread개까지 trace event도 추가하며, 그 이후의 event는 dropped로 세지만
+// scope의 histogram은 계속 집계함. enable()을 호출하기 전에는 아무것도 기록하지 않음. 처음
+// 실행된 이후 비활성 호출 지점의 비용은 function-local static Site의 guard 확인(load와 분기)과
+// relaxed load 한 번, 분기 하나임. INSTRUMENT_DISABLED를 정의하면 macro가 완전히 제거됨.
+template<typename TimePolicy>
+class Instrumentation {
+public:
+    static constexpr std::size_t kMaxSites = 128;
+    static constexpr std::size_t kBuckets = 65; // Bucket b holds values of bit width b
+    static constexpr std::size_t kEventsPerThread = std::size_t(1) << 16;
+
+    // A named call site; INSTRUMENT_* macros create one static Site per call site
+    // 이름이 있는 호출 지점; INSTRUMENT_* macro는 호출 지점마다 static Site 하나를 만듦
+    class Site {
+    public:
+        Site(const char* name, SiteKind kind) : id(registerSite(name, kind)) {}
+
+        std::uint32_t index() const {
+            return id;
+        }
+
+    private:
+        std::uint32_t id; // kMaxSites when the table is full; such a site records nothing
+    };
+
+    // RAII scope timer
+    // RAII scope timer
+    class Scope {
+    public:
+        explicit Scope(const Site& site) {
+            if (enabled() && site.index() < kMaxSites) {
+                id = site.index();
+                start = TimePolicy::getNanoseconds();
+            }
+        }
+
+        ~Scope() {
+            if (id < kMaxSites) {
+                recordScope(id, start, TimePolicy::getNanoseconds() - start);
+            }
+        }
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        std::uint32_t id = kMaxSites;
+        std::uint64_t start = 0;
+    };
+
+    // Totals of one site name, merged over every thread
+    // 한 site 이름의 합계, 모든 thread에 대해 합산됨
+    struct Summary {
+        std::string name;
+        SiteKind kind = SiteKind::Scope;
+        std::uint64_t count = 0;
+        std::uint64_t sum = 0;
+        std::uint64_t max = 0;
+        std::array<std::uint64_t, kBuckets> buckets{};
+
+        double mean() const {
+            return count == 0 ? 0.0 : static_cast<double>(sum) / static_cast<double>(count);
+        }
+
+        // Upper bound of the power-of-two bucket that holds quantile q
+        // Quantile q가 속한 2의 거듭제곱 bucket의 상한
+        std::uint64_t percentile(double q) const {
+            std::uint64_t rank = static_cast<std::uint64_t>(q * static_cast<double>(count));
+            std::uint64_t seen = 0;
+            for (std::size_t b = 0; b < kBuckets; ++b) {
+                seen += buckets[b];
+                if (seen > rank) {
+                    return b == 0 ? 0 : std::min(max, b >= 64 ? ~std::uint64_t(0) : (std::uint64_t(1) << b) - 1);
+                }
+            }
+            return max;
+        }
+    };
+
+    static void enable() {
+        std::uint64_t unset = 0;
+        epochNs.compare_exchange_strong(unset, TimePolicy::getNanoseconds(), std::memory_order_relaxed);
+        enabledFlag.store(true, std::memory_order_relaxed);
+    }
+
+    static void disable() {
+        enabledFlag.store(false, std::memory_order_relaxed);
+    }
+
+    static bool enabled() {
+        return enabledFlag.load(std::memory_order_relaxed);
+    }
+
+    static void count(const Site& site, std::uint64_t delta = 1) {
+        if (enabled() && site.index() < kMaxSites) {
+            Stats& stats = local().stats[site.index()];
+            bump(stats.count, 1);
+            bump(stats.sum, delta);
+        }
+    }
+
+    static void record(const Site& site, std::uint64_t value) {
+        if (enabled() && site.index() < kMaxSites) {
+            addValue(local().stats[site.index()], value);
+        }
+    }
+
+    // Snapshot of every site, merged by name; safe while other threads record
+    // 모든 site의 snapshot, 이름별로 합산됨; 다른 thread가 기록하는 중에도 안전
+    static std::vector<Summary> summarize() {
+        std::vector<Summary> summaries;
+        std::vector<std::size_t> slotOf(kMaxSites, ~std::size_t(0));
+        std::size_t sites = std::min<std::size_t>(siteCount.load(std::memory_order_acquire), kMaxSites);
+        for (std::size_t id = 0; id < sites; ++id) {
+            const char* name = siteTable[id].name.load(std::memory_order_acquire);
+            if (name == nullptr) {
+                continue;
+            }
+            SiteKind kind = siteTable[id].kind;
+            auto same = std::find_if(summaries.begin(), summaries.end(), [&](const Summary& s) {
+                return s.kind == kind && s.name == name;
+            });
+            if (same == summaries.end()) {
+                summaries.push_back(Summary{name, kind, 0, 0, 0, {}});
+                same = summaries.end() - 1;
+            }
+            slotOf[id] = static_cast<std::size_t>(same - summaries.begin());
+        }
+        for (ThreadBuffer* buffer = buffers.load(std::memory_order_acquire); buffer; buffer = buffer->next) {
+            for (std::size_t id = 0; id < sites; ++id) {
+                if (slotOf[id] == ~std::size_t(0)) {
+                    continue;
+                }
+                const Stats& stats = buffer->stats[id];
+                Summary& summary = summaries[slotOf[id]];
+                summary.count += stats.count.load(std::memory_order_relaxed);
+                summary.sum += stats.sum.load(std::memory_order_relaxed);
+                summary.max = std::max(summary.max, stats.max.load(std::memory_order_relaxed));
+                for (std::size_t b = 0; b < kBuckets; ++b) {
+                    summary.buckets[b] += stats.buckets[b].load(std::memory_order_relaxed);
+                }
+            }
+        }
+        return summaries;
+    }
+
+    // Trace events that did not fit in their thread's buffer
+    // Thread buffer에 들어가지 못한 trace event 수
+    static std::uint64_t droppedEvents() {
+        std::uint64_t dropped = 0;
+        for (ThreadBuffer* buffer = buffers.load(std::memory_order_acquire); buffer; buffer = buffer->next) {
+            dropped += buffer->dropped.load(std::memory_order_relaxed);
+        }
+        return dropped;
+    }
+
+    // Print one line per site: count, and mean/p50/p99/max for scopes (ns) and values
+    // Site마다 한 줄 출력: count, 그리고 scope (ns)와 value의 mean/p50/p99/max
+    static void printSummary(std::ostream& out = std::cout) {
+        out << std::left << std::setw(32) << "site" << std::right << std::setw(12) << "count" << std::setw(14)
+            << "sum/mean" << std::setw(12) << "p50 <=" << std::setw(12) << "p99 <=" << std::setw(12) << "max"
+            << std::endl;
+        for (const Summary& s : summarize()) {
+            out << std::left << std::setw(32) << s.name << std::right << std::setw(12) << s.count;
+            if (s.kind == SiteKind::Counter) {
+                out << std::setw(14) << s.sum << std::endl;
+                continue;
+            }
+            out << std::fixed << std::setprecision(1) << std::setw(14) << s.mean() << std::setw(12)
+                << s.percentile(0.50) << std::setw(12) << s.percentile(0.99) << std::setw(12) << s.max
+                << std::endl;
+        }
+        std::uint64_t dropped = droppedEvents();
+        if (dropped != 0) {
+            out << "(" << dropped << " trace events dropped; the totals above include them)" << std::endl;
+        }
+    }
+
+    // Write every scope as a Chrome trace complete event, and counters at their final value
+    // 모든 scope를 Chrome trace complete event로, counter는 최종 값으로 기록
+    //
+    // Open the file in chrome://tracing or https://ui.perfetto.dev.
+    // 파일은 chrome://tracing 또는 https://ui.perfetto.dev에서 열 수 있음.
+    static void writeChromeTrace(std::ostream& out) {
+        std::uint64_t epoch = epochNs.load(std::memory_order_relaxed);
+        std::uint64_t last = 0;
+        bool first = true;
+        auto separator = [&out, &first]() {
+            out << (first ? "\n" : ",\n");
+            first = false;
+        };
+        out << "{\"displayTimeUnit\": \"ns\", \"traceEvents\": [";
+        out << std::fixed << std::setprecision(3);
+        for (ThreadBuffer* buffer = buffers.load(std::memory_order_acquire); buffer; buffer = buffer->next) {
+            std::size_t events = buffer->eventCount.load(std::memory_order_acquire);
+            for (std::size_t i = 0; i < events; ++i) {
+                const Event& event = buffer->events[i];
+                separator();
+                out << "{\"name\": \"";
+                writeEscaped(out, siteTable[event.site].name.load(std::memory_order_acquire));
+                out << "\", \"cat\": \"scope\", \"ph\": \"X\", \"pid\": 1, \"tid\": " << buffer->threadId
+                    << ", \"ts\": " << static_cast<double>(event.start - epoch) / 1000.0
+                    << ", \"dur\": " << static_cast<double>(event.duration) / 1000.0 << "}";
+                last = std::max(last, event.start + event.duration - epoch);
+            }
+        }
+        for (const Summary& s : summarize()) {
+            if (s.kind != SiteKind::Counter) {
+                continue;
+            }
+            separator();
+            out << "{\"name\": \"";
+            writeEscaped(out, s.name.c_str());
+            out << "\", \"cat\": \"counter\", \"ph\": \"C\", \"pid\": 1, \"ts\": "
+                << static_cast<double>(last) / 1000.0 << ", \"args\": {\"value\": " << s.sum << "}}";
+        }
+        out << "\n]}\n";
+    }
+
+    static bool writeChromeTrace(const std::string& path) {
+        std::ofstream file(path);
+        if (!file) {
+            return false;
+        }
+        writeChromeTrace(file);
+        return static_cast<bool>(file);
+    }
+
+private:
+    // Written only by the owning thread; atomics let readers sum it at any time
+    // 소유 thread만 기록함; atomic이므로 reader가 언제든 합산할 수 있음
+    struct Stats {
+        std::atomic<std::uint64_t> count{0};
+        std::atomic<std::uint64_t> sum{0};
+        std::atomic<std::uint64_t> max{0};
+        std::array<std::atomic<std::uint64_t>, kBuckets> buckets{};
+    };
+
+    struct Event {
+        std::uint64_t start;
+        std::uint64_t duration;
+        std::uint32_t site;
+    };
+
+    struct ThreadBuffer {
+        std::uint32_t threadId = 0;
+        ThreadBuffer* next = nullptr; // Set before the buffer is published, then never changed
+        std::array<Stats, kMaxSites> stats{};
+        std::unique_ptr<Event[]> events; // Allocated by the first scope
+        std::atomic<std::size_t> eventCount{0};
+        std::atomic<std::uint64_t> dropped{0};
+    };
+
+    struct SiteEntry {
+        std::atomic<const char*> name{nullptr};
+        SiteKind kind = SiteKind::Scope;
+    };
+
+    // Deletes the buffers at exit, after every thread has stopped recording
+    // 모든 thread가 기록을 마친 뒤, 종료 시 buffer를 삭제
+    struct BufferList {
+        ~BufferList() {
+            ThreadBuffer* buffer = buffers.load(std::memory_order_acquire);
+            while (buffer != nullptr) {
+                ThreadBuffer* next = buffer->next;
+                delete buffer;
+                buffer = next;
+            }
+        }
+    };
+
+    // Owner-only update: no other thread writes this value, so no read-modify-write is needed
+    // 소유 thread 전용 갱신: 다른 thread가 이 값을 쓰지 않으므로 read-modify-write가 필요 없음
+    static void bump(std::atomic<std::uint64_t>& value, std::uint64_t delta) {
+        value.store(value.load(std::memory_order_relaxed) + delta, std::memory_order_relaxed);
+    }
+
+    static void addValue(Stats& stats, std::uint64_t value) {
+        bump(stats.count, 1);
+        bump(stats.sum, value);
+        if (value > stats.max.load(std::memory_order_relaxed)) {
+            stats.max.store(value, std::memory_order_relaxed);
+        }
+        std::size_t bucket = value == 0 ? 0 : static_cast<std::size_t>(64 - __builtin_clzll(value));
+        bump(stats.buckets[bucket], 1);
+    }
+
+    static void recordScope(std::uint32_t id, std::uint64_t start, std::uint64_t duration) {
+        ThreadBuffer& buffer = local();
+        addValue(buffer.stats[id], duration);
+        std::size_t events = buffer.eventCount.load(std::memory_order_relaxed);
+        if (events == kEventsPerThread) {
+            bump(buffer.dropped, 1);
+            return;
+        }
+        if (!buffer.events) {
+            buffer.events.reset(new Event[kEventsPerThread]);
+        }
+        buffer.events[events] = Event{start, duration, id};
+        buffer.eventCount.store(events + 1, std::memory_order_release); // Publishes the event
+                                                                        // Event를 공개함
+    }
+
+    static std::uint32_t registerSite(const char* name, SiteKind kind) {
+        std::uint32_t id = siteCount.fetch_add(1, std::memory_order_relaxed);
+        if (id >= kMaxSites) {
+            return static_cast<std::uint32_t>(kMaxSites);
+        }
+        siteTable[id].kind = kind;
+        siteTable[id].name.store(name, std::memory_order_release);
+        return id;
+    }
+
+    static ThreadBuffer& local() {
+        thread_local ThreadBuffer* buffer = publish();
+        return *buffer;
+    }
+
+    // Create this thread's buffer and push it onto the list with one compare-exchange
+    // 이 thread의 buffer를 만들고 compare-exchange 한 번으로 list에 push
+    static ThreadBuffer* publish() {
+        static BufferList list; // Constructed before the first buffer, destroyed after main()
+                                // 첫 buffer보다 먼저 생성되고 main() 이후에 소멸됨
+        (void)list;
+        auto* buffer = new ThreadBuffer;
+        buffer->threadId = nextThreadId.fetch_add(1, std::memory_order_relaxed);
+        ThreadBuffer* head = buffers.load(std::memory_order_relaxed);
+        do {
+            buffer->next = head;
+        } while (!buffers.compare_exchange_weak(head, buffer, std::memory_order_release,
+                                                std::memory_order_relaxed));
+        return buffer;
+    }
+
+    static void writeEscaped(std::ostream& out, const char* text) {
+        for (; *text != '\0'; ++text) {
+            if (*text == '"' || *text == '\\') {
+                out << '\\';
+            }
+            out << *text;
+        }
+    }
+
+    static inline std::atomic<bool> enabledFlag{false};
+    static inline std::atomic<std::uint64_t> epochNs{0};
+    static inline std::atomic<ThreadBuffer*> buffers{nullptr};
+    static inline std::atomic<std::uint32_t> nextThreadId{1};
+    static inline std::atomic<std::uint32_t> siteCount{0};
+    static inline std::array<SiteEntry, kMaxSites> siteTable{};
+};
+
+// Enables instrumentation when the program gets --trace=FILE, and on exit prints
+// the summary and writes FILE as a Chrome trace
+// Program이 --trace=FILE을 받으면 계측을 활성화하고, 종료 시 요약을 출력하며 FILE을
+// Chrome trace로 기록
+//
+// Declare it first in main() so that it is destroyed after everything it measures.
+// 측정 대상보다 나중에 소멸되도록 main()에서 가장 먼저 선언해야 함.
+template<typename TimePolicy>
+class TraceSession {
+public:
+    TraceSession(int argc, char* argv[]) {
+        for (int i = 1; i < argc; ++i) {
+            if (std::strncmp(argv[i], "--trace=", 8) == 0) {
+                path = argv[i] + 8;
+            }
+        }
+        if (!path.empty()) {
+            Instrumentation<TimePolicy>::enable();
+        }
+    }
+
+    ~TraceSession() {
+        if (path.empty()) {
+            return;
+        }
+        Instrumentation<TimePolicy>::disable();
+        std::cout << "\nInstrumentation summary (ns for scopes)" << std::endl;
+        Instrumentation<TimePolicy>::printSummary(std::cout);
+        if (Instrumentation<TimePolicy>::writeChromeTrace(path)) {
+            std::cout << "Chrome trace written to " << path << std::endl;
+        } else {
+            std::cerr << "Could not write " << path << std::endl;
+        }
+    }
+
+    TraceSession(const TraceSession&) = delete;
+    TraceSession& operator=(const TraceSession&) = delete;
+
+private:
+    std::string path;
+};
+
+// The clock used by the INSTRUMENT_* macros; define INSTRUMENT_TIME_POLICY to change it
+// INSTRUMENT_* macro가 사용하는 clock; INSTRUMENT_TIME_POLICY를 정의하여 변경
+#if !defined(INSTRUMENT_TIME_POLICY)
+#define INSTRUMENT_TIME_POLICY NanosecondTimePolicy
+#endif
+
+using Instrument = Instrumentation<INSTRUMENT_TIME_POLICY>;
+using InstrumentTraceSession = TraceSession<INSTRUMENT_TIME_POLICY>;
+
+#define INSTRUMENT_CONCAT_INNER(a, b) a##b
+#define INSTRUMENT_CONCAT(a, b) INSTRUMENT_CONCAT_INNER(a, b)
+
+#if defined(INSTRUMENT_DISABLED)
+#define INSTRUMENT_SCOPE(name) static_cast<void>(0)
+#define INSTRUMENT_COUNT(name, delta) static_cast<void>(0)
+#define INSTRUMENT_VALUE(name, value) static_cast<void>(0)
+#else
+// Time the rest of the enclosing block
+// 감싸는 block의 나머지 부분을 측정
+#define INSTRUMENT_SCOPE(name)                                                                            \
+    static const Instrument::Site INSTRUMENT_CONCAT(instrumentSite, __LINE__)(name, SiteKind::Scope);    \
+    const Instrument::Scope INSTRUMENT_CONCAT(instrumentScope, __LINE__)(INSTRUMENT_CONCAT(instrumentSite, __LINE__))
+
+// Add delta to a named counter
+// 이름이 있는 counter에 delta를 더함
+#define INSTRUMENT_COUNT(name, delta)                                                  \
+    do {                                                                               \
+        static const Instrument::Site instrumentSite(name, SiteKind::Counter);         \
+        Instrument::count(instrumentSite, static_cast<std::uint64_t>(delta));          \
+    } while (0)
+
+// Add a value to a named histogram
+// 이름이 있는 histogram에 값을 추가
+#define INSTRUMENT_VALUE(name, value)                                                  \
+    do {                                                                               \
+        static const Instrument::Site instrumentSite(name, SiteKind::Value);           \
+        Instrument::record(instrumentSite, static_cast<std::uint64_t>(value));         \
+    } while (0)
+#endif
+
+#endif // COMMON_INSTRUMENT_H
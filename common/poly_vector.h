@@ -0,0 +1,241 @@
+#ifndef COMMON_POLY_VECTOR_H
+#define COMMON_POLY_VECTOR_H
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+// Polymorphic objects stored by value, one contiguous segment per type
+// 값으로 저장되는 polymorphic 객체, type마다 연속된 segment 하나
+//
+// A vector<unique_ptr<Base>> allocates every object separately, so walking it
+// chases a pointer to a random heap address per element, and a random mix of
+// types makes every virtual call a likely branch miss. PolyVector keeps each
+// derived type in its own std::vector<Derived> and visits one type after the
+// other: the objects are contiguous and the indirect branch goes to the same
+// target for a whole segment. Insertion order across types is not kept.
+// Adding an object can move the others of the same type, like push_back on a
+// std::vector, so do not hold references across emplace().
+// vector<unique_ptr<Base>>는 객체마다 따로 할당하므로, 순회할 때 요소마다 무작위 heap
+// 주소로 pointer를 따라가며, type이 무작위로 섞여 있으면 virtual 호출마다 branch miss가
+// 나기 쉬움. PolyVector는 derived type마다 자신의 std::vector<Derived>에 보관하고 type을
+// 하나씩 차례로 방문함: 객체는 연속되어 있고 간접 분기는 segment 전체에서 같은 대상으로
+// 감. Type 사이의 삽입 순서는 유지되지 않음. std::vector의 push_back처럼 객체를 추가하면
+// 같은 type의 다른 객체가 이동할 수 있으므로, emplace()를 넘어 reference를 유지하지 말 것.
+template<typename Base>
+class PolyVector {
+public:
+    PolyVector() = default;
+    PolyVector(PolyVector&&) = default;
+    PolyVector& operator=(PolyVector&&) = default;
+
+    // Construct a Derived in place at the end of its type's segment
+    // 자신의 type segment 끝에 Derived를 직접 생성
+    template<typename Derived, typename... Args>
+    Derived& emplace(Args&&... args) {
+        static_assert(std::is_base_of<Base, Derived>::value, "Derived must derive from Base");
+        std::vector<Derived>& items = segment<Derived>().items;
+        items.emplace_back(std::forward<Args>(args)...);
+        ++count;
+        return items.back();
+    }
+
+    template<typename Derived>
+    void reserve(std::size_t capacity) {
+        segment<Derived>().items.reserve(capacity);
+    }
+
+    std::size_t size() const {
+        return count;
+    }
+
+    bool empty() const {
+        return count == 0;
+    }
+
+    // Destroy every object; like std::vector::clear(), the segments keep their capacity
+    // 모든 객체를 파괴; std::vector::clear()처럼 segment는 capacity를 유지함
+    void clear() {
+        for (const auto& s : segments) {
+            s->clear();
+        }
+        count = 0;
+    }
+
+    // Call f(Base&) on every object, one type after another
+    // 모든 객체에 대해 type별로 차례로 f(Base&)를 호출
+    template<typename F>
+    void forEach(F&& f) {
+        for (const auto& s : segments) {
+            Span span = s->span();
+            for (std::size_t i = 0; i < span.count; ++i) {
+                f(*reinterpret_cast<Base*>(span.first + i * span.stride));
+            }
+        }
+    }
+
+    template<typename F>
+    void forEach(F&& f) const {
+        for (const auto& s : segments) {
+            Span span = s->span();
+            for (std::size_t i = 0; i < span.count; ++i) {
+                f(*reinterpret_cast<const Base*>(span.first + i * span.stride));
+            }
+        }
+    }
+
+    // Call f(Derived&) on every object of exactly type Derived
+    // 정확히 Derived type인 모든 객체에 대해 f(Derived&)를 호출
+    //
+    // The static type is known here, so a call through a final class or a
+    // qualified name needs no vtable lookup.
+    // 여기서는 static type을 알고 있으므로, final class나 한정된 이름을 통한 호출은 vtable
+    // 조회가 필요 없음.
+    template<typename Derived, typename F>
+    void forEachOf(F&& f) {
+        if (Segment<Derived>* s = find<Derived>()) {
+            for (Derived& item : s->items) {
+                f(item);
+            }
+        }
+    }
+
+    template<typename Derived>
+    std::size_t countOf() const {
+        const Segment<Derived>* s = find<Derived>();
+        return s == nullptr ? 0 : s->items.size();
+    }
+
+private:
+    // First Base subobject of a segment and the distance between two of them
+    // Segment의 첫 Base subobject와 두 subobject 사이의 거리
+    struct Span {
+        char* first;
+        std::size_t stride;
+        std::size_t count;
+    };
+
+    struct SegmentBase {
+        const void* type;
+
+        explicit SegmentBase(const void* t) : type(t) {}
+        virtual ~SegmentBase() = default;
+        virtual Span span() = 0;
+        virtual void clear() = 0;
+    };
+
+    template<typename Derived>
+    struct Segment : SegmentBase {
+        std::vector<Derived> items;
+
+        Segment() : SegmentBase(typeKey<Derived>()) {}
+
+        Span span() override {
+            if (items.empty()) {
+                return Span{nullptr, sizeof(Derived), 0};
+            }
+            Base* first = &items.front(); // Adjusts to the Base subobject
+                                          // Base subobject로 조정됨
+            return Span{reinterpret_cast<char*>(first), sizeof(Derived), items.size()};
+        }
+
+        void clear() override {
+            items.clear();
+        }
+    };
+
+    // One address per type, so no RTTI is needed to tell segments apart
+    // Type마다 주소 하나이므로 segment를 구분하는 데 RTTI가 필요 없음
+    template<typename Derived>
+    static const void* typeKey() {
+        static const char key = 0;
+        return &key;
+    }
+
+    // A handful of types, searched linearly
+    // 몇 개의 type, 선형 탐색
+    template<typename Derived>
+    Segment<Derived>* find() const {
+        for (const auto& s : segments) {
+            if (s->type == typeKey<Derived>()) {
+                return static_cast<Segment<Derived>*>(s.get());
+            }
+        }
+        return nullptr;
+    }
+
+    template<typename Derived>
+    Segment<Derived>& segment() {
+        if (Segment<Derived>* s = find<Derived>()) {
+            return *s;
+        }
+        segments.push_back(std::make_unique<Segment<Derived>>());
+        return static_cast<Segment<Derived>&>(*segments.back());
+    }
+
+    std::vector<std::unique_ptr<SegmentBase>> segments;
+    std::size_t count = 0;
+};
+
+// Closed set of types stored inline as std::variant, in insertion order
+// std::variant로 inline 저장되는 닫힌 type 집합, 삽입 순서 유지
+//
+// When every type is known up front, each element is one variant in a single
+// contiguous vector, and forEach() branches on the stored index with
+// std::visit and passes the object as its concrete type, so the types need
+// no common base class or virtual functions. Every slot is as large as the
+// largest type.
+// 모든 type을 미리 알고 있으면, 각 요소는 하나의 연속된 vector 안의 variant 하나이며,
+// forEach()는 std::visit으로 저장된 index에 따라 분기하여 객체를 구체 type으로 넘기므로
+// type들에 공통 base class나 virtual function이 필요 없음. 모든 slot은 가장 큰 type만큼 큼.
+template<typename... Ts>
+class VariantVector {
+public:
+    using Value = std::variant<Ts...>;
+
+    template<typename T, typename... Args>
+    T& emplace(Args&&... args) {
+        items.emplace_back(std::in_place_type<T>, std::forward<Args>(args)...);
+        return std::get<T>(items.back());
+    }
+
+    void reserve(std::size_t capacity) {
+        items.reserve(capacity);
+    }
+
+    std::size_t size() const {
+        return items.size();
+    }
+
+    bool empty() const {
+        return items.empty();
+    }
+
+    void clear() {
+        items.clear();
+    }
+
+    // Call f(T&) with the concrete type of every element
+    // 모든 요소의 구체 type으로 f(T&)를 호출
+    template<typename F>
+    void forEach(F&& f) {
+        for (Value& item : items) {
+            std::visit(f, item);
+        }
+    }
+
+    template<typename F>
+    void forEach(F&& f) const {
+        for (const Value& item : items) {
+            std::visit(f, item);
+        }
+    }
+
+private:
+    std::vector<Value> items;
+};
+
+#endif // COMMON_POLY_VECTOR_H
@@ -0,0 +1,122 @@
+#ifndef COMMON_RING_BUFFER_H
+#define COMMON_RING_BUFFER_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+// Bounded lock-free ring buffer (multi-producer, multi-consumer)
+// 크기가 제한된 lock-free ring buffer (multi-producer, multi-consumer)
+//
+// Every cell carries a sequence number that tells producers and consumers
+// whether the cell is free or holds a value for the current lap, so push and
+// pop only need one compare-exchange on their own index. It is safe for any
+// number of producers and consumers, which covers the SPSC and MPSC cases.
+// 각 cell은 sequence 번호를 가지며, 이 번호로 producer와 consumer가 cell이 비었는지
+// 현재 lap의 값을 가지고 있는지 판단함. 따라서 push와 pop은 자신의 index에 대한
+// compare-exchange 한 번만 필요함. Producer와 consumer 수에 제한이 없으므로
+// SPSC와 MPSC 경우를 모두 다룸.
+template<typename T>
+class RingBuffer {
+public:
+    // Capacity is rounded up to a power of two (minimum 2)
+    // Capacity는 2의 거듭제곱으로 올림됨 (최소 2)
+    explicit RingBuffer(std::size_t requestedCapacity) {
+        std::size_t capacity = 2;
+        while (capacity < requestedCapacity) {
+            capacity <<= 1;
+        }
+        mask = capacity - 1;
+        cells.reset(new Cell[capacity]);
+        for (std::size_t i = 0; i < capacity; ++i) {
+            cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    RingBuffer(const RingBuffer&) = delete;
+    RingBuffer& operator=(const RingBuffer&) = delete;
+
+    std::size_t capacity() const {
+        return mask + 1;
+    }
+
+    // Push a value; returns false (leaving value untouched) if the buffer is full
+    // 값을 push; buffer가 가득 차면 false 반환 (value는 변경되지 않음)
+    template<typename U>
+    bool try_push(U&& value) {
+        Cell* cell;
+        std::size_t pos = enqueuePos.load(std::memory_order_relaxed);
+        while (true) {
+            cell = &cells[pos & mask];
+            std::size_t seq = cell->sequence.load(std::memory_order_acquire);
+            std::intptr_t diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos);
+            if (diff == 0) {
+                if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false; // Full
+                              // 가득 참
+            } else {
+                pos = enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+        cell->value = std::forward<U>(value);
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Pop the oldest value; returns false if the buffer is empty
+    // 가장 오래된 값을 pop; buffer가 비어 있으면 false 반환
+    bool try_pop(T& out) {
+        Cell* cell;
+        std::size_t pos = dequeuePos.load(std::memory_order_relaxed);
+        while (true) {
+            cell = &cells[pos & mask];
+            std::size_t seq = cell->sequence.load(std::memory_order_acquire);
+            std::intptr_t diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos + 1);
+            if (diff == 0) {
+                if (dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false; // Empty
+                              // 비어 있음
+            } else {
+                pos = dequeuePos.load(std::memory_order_relaxed);
+            }
+        }
+        out = std::move(cell->value);
+        cell->sequence.store(pos + mask + 1, std::memory_order_release);
+        return true;
+    }
+
+    // True if no value is ready at the head (a snapshot under concurrency)
+    // Head에 준비된 값이 없으면 true (동시 실행 중에는 snapshot 값)
+    bool empty() const {
+        std::size_t pos = dequeuePos.load(std::memory_order_acquire);
+        return cells[pos & mask].sequence.load(std::memory_order_acquire) != pos + 1;
+    }
+
+private:
+    struct Cell {
+        std::atomic<std::size_t> sequence;
+        T value;
+    };
+
+    // Padding keeps the producer and consumer indices on separate cache lines
+    // Padding으로 producer와 consumer index를 서로 다른 cache line에 둠
+    static constexpr std::size_t kCacheLineSize = 64;
+
+    std::unique_ptr<Cell[]> cells;
+    std::size_t mask = 0;
+    char pad0[kCacheLineSize];
+    std::atomic<std::size_t> enqueuePos{0};
+    char pad1[kCacheLineSize - sizeof(std::atomic<std::size_t>)];
+    std::atomic<std::size_t> dequeuePos{0};
+    char pad2[kCacheLineSize - sizeof(std::atomic<std::size_t>)];
+};
+
+#endif // COMMON_RING_BUFFER_H
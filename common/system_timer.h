@@ -0,0 +1,442 @@
+#ifndef COMMON_SYSTEM_TIMER_H
+#define COMMON_SYSTEM_TIMER_H
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+// X86 Platform Time Policy
+// X86 플랫폼 시간 정책
+// Uses std::chrono for time measurement (standard C++ library)
+// 시간 측정을 위해 std::chrono 사용 (표준 C++ 라이브러리)
+struct X86TimePolicy {
+    // Initialize time system (not needed for x86)
+    // 시간 시스템 초기화 (x86에서는 불필요)
+    static void init() {
+        std::cout << "[X86] Time system initialized (using std::chrono)" << std::endl;
+    }
+
+    // Get current time in milliseconds
+    // 현재 시간을 밀리초 단위로 얻기
+    static uint32_t getMilliseconds() {
+        using namespace std::chrono;
+        auto now = steady_clock::now();
+        auto ms = duration_cast<milliseconds>(now.time_since_epoch()).count();
+        return static_cast<uint32_t>(ms);
+    }
+
+    // Delay for specified milliseconds
+    // 지정된 밀리초 동안 지연
+    static void delay(uint32_t ms) {
+        std::cout << "[X86] Delaying " << ms << "ms using std::this_thread::sleep_for" << std::endl;
+        std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+    }
+};
+
+// Embedded Platform Time Policy
+// 임베디드 플랫폼 시간 정책
+// Simulates hardware timer (SysTick) for embedded systems
+// 임베디드 시스템을 위한 하드웨어 타이머(SysTick) 시뮬레이션
+struct EmbeddedTimePolicy {
+    // Simulated SysTick counter (in real hardware, this is updated by interrupt)
+    // 시뮬레이션된 SysTick 카운터 (실제 하드웨어에서는 인터럽트로 업데이트됨)
+    static uint32_t systick_counter;
+
+    // Initialize SysTick timer (simulated)
+    // SysTick 타이머 초기화 (시뮬레이션)
+    static void init() {
+        std::cout << "[Embedded] SysTick timer initialized" << std::endl;
+        std::cout << "[Embedded] Timer configured for 1ms tick" << std::endl;
+        systick_counter = 0;
+    }
+
+    // Get current time in milliseconds from SysTick counter
+    // SysTick 카운터에서 현재 시간을 밀리초 단위로 얻기
+    static uint32_t getMilliseconds() {
+        // In real embedded system: return systick_counter;
+        // 실제 임베디드 시스템: return systick_counter;
+        // For simulation, we use chrono but pretend it's a hardware register
+        // 시뮬레이션을 위해 chrono를 사용하지만 하드웨어 레지스터인 척함
+        using namespace std::chrono;
+        auto now = steady_clock::now();
+        auto ms = duration_cast<milliseconds>(now.time_since_epoch()).count();
+        return static_cast<uint32_t>(ms);
+    }
+
+    // Delay using busy-wait loop (typical for embedded systems)
+    // 바쁜 대기 루프를 사용한 지연 (임베디드 시스템에 전형적)
+    static void delay(uint32_t ms) {
+        std::cout << "[Embedded] Delaying " << ms << "ms using busy-wait loop" << std::endl;
+        uint32_t start = getMilliseconds();
+        // Busy-wait loop (polling)
+        // 바쁜 대기 루프 (폴링)
+        while (getMilliseconds() - start < ms) {
+            // In real hardware: __NOP() or WFI() instruction
+            // 실제 하드웨어: __NOP() 또는 WFI() 명령어
+        }
+    }
+};
+
+// Initialize static member
+// 정적 멤버 초기화
+inline uint32_t EmbeddedTimePolicy::systick_counter = 0;
+
+// Nanosecond Time Policy
+// 나노초 시간 정책
+// Reads std::chrono::steady_clock as a 64-bit nanosecond count, which does not wrap for centuries
+// std::chrono::steady_clock을 64-bit 나노초 값으로 읽으며, 수백 년 동안 wrap되지 않음
+struct NanosecondTimePolicy {
+    // Initialize time system (nothing to set up)
+    // 시간 시스템 초기화 (설정할 것 없음)
+    static void init() {
+        std::cout << "[Nanosecond] Time system initialized (using std::chrono::steady_clock)" << std::endl;
+    }
+
+    // Get current time in nanoseconds
+    // 현재 시간을 나노초 단위로 얻기
+    static std::uint64_t getNanoseconds() {
+        using namespace std::chrono;
+        return static_cast<std::uint64_t>(duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count());
+    }
+
+    // Get current time in milliseconds
+    // 현재 시간을 밀리초 단위로 얻기
+    static uint32_t getMilliseconds() {
+        return static_cast<uint32_t>(getNanoseconds() / 1000000);
+    }
+
+    // Delay for specified milliseconds
+    // 지정된 밀리초 동안 지연
+    static void delay(uint32_t ms) {
+        std::cout << "[Nanosecond] Delaying " << ms << "ms using std::this_thread::sleep_for" << std::endl;
+        std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+    }
+};
+
+// Time Stamp Counter Time Policy
+// Time Stamp Counter 시간 정책
+// Reads the CPU cycle counter (rdtsc on x86, cntvct_el0 on ARM64) and converts it
+// to nanoseconds with a scale measured against steady_clock by init()
+// CPU cycle counter (x86은 rdtsc, ARM64는 cntvct_el0)를 읽고, init()이 steady_clock과
+// 비교하여 측정한 배율로 나노초로 변환
+//
+// A counter read costs a few nanoseconds and needs no system call, which makes
+// it the cheapest clock for timing short code. It assumes a constant-rate
+// counter (invariant TSC on current x86 CPUs). Call init() before use; other
+// platforms fall back to steady_clock.
+// Counter 읽기는 몇 나노초이며 system call이 필요 없으므로 짧은 code의 시간 측정에
+// 가장 저렴한 clock임. 일정한 속도의 counter (현재 x86 CPU의 invariant TSC)를 가정함.
+// 사용 전에 init()을 호출해야 하며, 다른 플랫폼에서는 steady_clock을 사용함.
+struct TscTimePolicy {
+    // Calibrate the counter against steady_clock
+    // Counter를 steady_clock과 비교하여 보정
+    static void init() {
+        calibrate(std::chrono::milliseconds(20));
+        std::cout << "[TSC] Time system initialized (" << ticksPerMicrosecond()
+                  << " ticks/us, calibrated against std::chrono::steady_clock)" << std::endl;
+    }
+
+    // Raw counter value
+    // 원시 counter 값
+    static std::uint64_t readTicks() {
+#if defined(__x86_64__) || defined(__i386__)
+        return __rdtsc();
+#elif defined(__aarch64__)
+        std::uint64_t ticks;
+        asm volatile("mrs %0, cntvct_el0" : "=r"(ticks));
+        return ticks;
+#else
+        return NanosecondTimePolicy::getNanoseconds();
+#endif
+    }
+
+    // Get current time in nanoseconds, on the steady_clock time line
+    // 현재 시간을 steady_clock 시간축의 나노초 단위로 얻기
+    static std::uint64_t getNanoseconds() {
+        std::uint64_t ticks = readTicks() - baseTicks;
+#if defined(__SIZEOF_INT128__)
+        return baseNanoseconds + static_cast<std::uint64_t>((static_cast<unsigned __int128>(ticks) * scale) >> 32);
+#else
+        return baseNanoseconds + static_cast<std::uint64_t>(static_cast<long double>(ticks) * scale / 4294967296.0L);
+#endif
+    }
+
+    // Get current time in milliseconds
+    // 현재 시간을 밀리초 단위로 얻기
+    static uint32_t getMilliseconds() {
+        return static_cast<uint32_t>(getNanoseconds() / 1000000);
+    }
+
+    // Delay for specified milliseconds
+    // 지정된 밀리초 동안 지연
+    static void delay(uint32_t ms) {
+        std::cout << "[TSC] Delaying " << ms << "ms using std::this_thread::sleep_for" << std::endl;
+        std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+    }
+
+    // Measure the counter rate over a window of steady_clock time
+    // steady_clock 시간의 구간 동안 counter 속도를 측정
+    static void calibrate(std::chrono::nanoseconds window) {
+        std::uint64_t startNs = NanosecondTimePolicy::getNanoseconds();
+        std::uint64_t startTicks = readTicks();
+        std::uint64_t endNs;
+        do {
+            endNs = NanosecondTimePolicy::getNanoseconds();
+        } while (endNs - startNs < static_cast<std::uint64_t>(window.count()));
+        std::uint64_t endTicks = readTicks();
+
+        std::uint64_t ticks = endTicks > startTicks ? endTicks - startTicks : 1;
+        // Nanoseconds per tick as a 32.32 fixed-point number
+        // Tick당 나노초를 32.32 고정소수점 수로 표현
+        scale = static_cast<std::uint64_t>((static_cast<long double>(endNs - startNs) * 4294967296.0L) / ticks);
+        baseTicks = endTicks;
+        baseNanoseconds = endNs;
+    }
+
+    static double ticksPerMicrosecond() {
+        return scale == 0 ? 0.0 : 1000.0 * 4294967296.0 / static_cast<double>(scale);
+    }
+
+    static inline std::uint64_t baseTicks = 0;
+    static inline std::uint64_t baseNanoseconds = 0;
+    static inline std::uint64_t scale = 0; // Nanoseconds per tick << 32
+                                           // Tick당 나노초 << 32
+};
+
+// Hybrid Sleep-then-Spin Time Policy
+// Sleep 후 spin하는 hybrid 시간 정책
+// Sleeps for most of a delay, then spins on the clock for the final stretch
+// 지연의 대부분은 sleep하고, 마지막 구간은 clock을 보며 spin함
+//
+// sleep_for() wakes up late by the scheduler's granularity, often 50-100 us,
+// so a short delay through it is mostly overshoot. A busy-wait is accurate
+// but holds a core for the whole delay. This policy sleeps until
+// spinThreshold before the deadline, in a few steps when the delay is long.
+// It then spins with a pause instruction, or yield on ARM. While more than
+// kYieldAbove remains, it also gives the rest of the time slice away with
+// std::this_thread::yield(). init() measures how late sleep_for() wakes up on
+// this machine and sets spinThreshold to a high percentile of that overshoot,
+// so the sleep almost never passes the deadline. A delay of 1 ms then costs
+// roughly spinThreshold of CPU time instead of 1 ms.
+// sleep_for()는 scheduler 단위만큼 늦게 깨어나며 흔히 50-100 us이므로, 짧은 지연은
+// 대부분이 초과 시간이 됨. Busy-wait는 정확하지만 지연 내내 core 하나를 점유함. 이
+// 정책은 마감 spinThreshold 전까지 sleep하며, 긴 지연은 몇 단계에 걸쳐 sleep함. 그다음
+// pause instruction으로 spin하며, ARM에서는 yield를 사용함. 남은 시간이 kYieldAbove보다
+// 길면 std::this_thread::yield()로 나머지 time slice도 양보함. init()은 이 machine에서
+// sleep_for()가 얼마나 늦게 깨어나는지 측정하여 spinThreshold를 그 초과 시간의 높은
+// 백분위수로 설정하므로, sleep이 마감을 지나는 경우는 거의 없음. 그러면 1 ms 지연의 CPU
+// 시간은 1 ms가 아니라 대략 spinThreshold가 됨.
+struct HybridTimePolicy {
+    static constexpr std::uint64_t kYieldAbove = 20000; // ns
+    static constexpr std::uint64_t kLongSleep = 1000000; // ns
+    static constexpr std::uint64_t kMaxSpinThreshold = 2000000; // ns; cap for a badly loaded machine
+                                                                // ns; 부하가 심한 machine을 위한 상한
+
+    // Measure sleep overshoot and set the spin threshold
+    // Sleep 초과 시간을 측정하고 spin threshold를 설정
+    static void init() {
+        calibrate();
+        std::cout << "[Hybrid] Time system initialized (spin for the last " << spinThreshold / 1000
+                  << "us of each delay)" << std::endl;
+    }
+
+    // Get current time in nanoseconds
+    // 현재 시간을 나노초 단위로 얻기
+    static std::uint64_t getNanoseconds() {
+        return NanosecondTimePolicy::getNanoseconds();
+    }
+
+    // Get current time in milliseconds
+    // 현재 시간을 밀리초 단위로 얻기
+    static uint32_t getMilliseconds() {
+        return static_cast<uint32_t>(getNanoseconds() / 1000000);
+    }
+
+    // Delay for specified milliseconds
+    // 지정된 밀리초 동안 지연
+    static void delay(uint32_t ms) {
+        std::cout << "[Hybrid] Delaying " << ms << "ms, sleeping then spinning" << std::endl;
+        delayNanoseconds(static_cast<std::uint64_t>(ms) * 1000000);
+    }
+
+    // Delay for specified nanoseconds, without logging
+    // 지정된 나노초 동안 지연, log 없음
+    static void delayNanoseconds(std::uint64_t ns) {
+        std::uint64_t deadline = getNanoseconds() + ns;
+        std::uint64_t threshold = spinThreshold;
+
+        // Sleep until the expected overshoot would reach the deadline. Overshoot
+        // grows with the sleep length, so a long sleep stops an eighth short and
+        // the loop sleeps again for the rest.
+        // 예상 초과 시간이 마감에 닿을 때까지 sleep. 초과 시간은 sleep 길이에 따라
+        // 커지므로, 긴 sleep은 1/8 일찍 멈추고 loop가 나머지를 다시 sleep함.
+        std::uint64_t now = getNanoseconds();
+        while (now < deadline && deadline - now > threshold) {
+            std::uint64_t slack = deadline - now - threshold;
+            if (slack > kLongSleep) {
+                slack -= slack / 8;
+            }
+            std::this_thread::sleep_for(std::chrono::nanoseconds(slack));
+            now = getNanoseconds();
+        }
+
+        // Spin for the rest
+        // 나머지는 spin
+        while (now < deadline) {
+            if (deadline - now > kYieldAbove) {
+                std::this_thread::yield();
+            } else {
+                cpuRelax();
+            }
+            now = getNanoseconds();
+        }
+    }
+
+    // Tell the CPU this is a spin-wait loop
+    // 이것이 spin-wait loop임을 CPU에 알림
+    static void cpuRelax() {
+#if defined(__x86_64__) || defined(__i386__)
+        _mm_pause();
+#elif defined(__aarch64__)
+        asm volatile("yield");
+#endif
+    }
+
+    // Set spinThreshold from the overshoot of short sleeps
+    // 짧은 sleep의 초과 시간으로 spinThreshold를 설정
+    static void calibrate(int samples = 100, std::chrono::nanoseconds request = std::chrono::microseconds(50)) {
+        std::vector<std::uint64_t> overshoot;
+        overshoot.reserve(static_cast<std::size_t>(samples));
+        const std::uint64_t requested = static_cast<std::uint64_t>(request.count());
+        for (int i = 0; i < samples; ++i) {
+            std::uint64_t start = getNanoseconds();
+            std::this_thread::sleep_for(request);
+            std::uint64_t slept = getNanoseconds() - start;
+            overshoot.push_back(slept > requested ? slept - requested : 0);
+        }
+        // 95th percentile plus a quarter as margin
+        // 95번째 백분위수에 여유분 1/4을 더함
+        std::sort(overshoot.begin(), overshoot.end());
+        std::uint64_t p95 = overshoot[overshoot.size() * 95 / 100];
+        spinThreshold = std::min(kMaxSpinThreshold, p95 + p95 / 4);
+    }
+
+    static inline std::uint64_t spinThreshold = 200000; // ns, until init() measures it
+                                                        // ns, init()이 측정하기 전까지
+};
+
+// True if TimePolicy provides getNanoseconds()
+// TimePolicy가 getNanoseconds()를 제공하면 true
+template<typename TimePolicy, typename = void>
+struct HasNanoseconds : std::false_type {};
+
+template<typename TimePolicy>
+struct HasNanoseconds<TimePolicy, std::void_t<decltype(TimePolicy::getNanoseconds())>> : std::true_type {};
+
+// True if TimePolicy provides delayNanoseconds()
+// TimePolicy가 delayNanoseconds()를 제공하면 true
+template<typename TimePolicy, typename = void>
+struct HasPreciseDelay : std::false_type {};
+
+template<typename TimePolicy>
+struct HasPreciseDelay<TimePolicy, std::void_t<decltype(TimePolicy::delayNanoseconds(std::uint64_t()))>>
+    : std::true_type {};
+
+// System Timer class template with Policy-Based Design
+// Policy-Based Design을 사용하는 시스템 타이머 클래스 템플릿
+//
+// Policies that provide getNanoseconds() get nanosecond resolution from
+// nanos() and measureElapsed(); the others are measured in milliseconds.
+// getNanoseconds()를 제공하는 policy는 nanos()와 measureElapsed()에서 나노초 해상도를
+// 가지며, 나머지는 밀리초 단위로 측정됨.
+template<typename TimePolicy>
+class SystemTimer {
+public:
+    static constexpr bool kHighResolution = HasNanoseconds<TimePolicy>::value;
+
+    // Initialize the timer system
+    // 타이머 시스템 초기화
+    static void initialize() {
+        TimePolicy::init();
+    }
+
+    // Get current time in milliseconds
+    // 현재 시간을 밀리초 단위로 얻기
+    static uint32_t millis() {
+        return TimePolicy::getMilliseconds();
+    }
+
+    // Delay for specified milliseconds
+    // 지정된 밀리초 동안 지연
+    static void delayMs(uint32_t ms) {
+        TimePolicy::delay(ms);
+    }
+
+    // Delay for any std::chrono::duration, without logging; policies without
+    // delayNanoseconds() round up to whole milliseconds
+    // 임의의 std::chrono::duration 동안 지연, log 없음; delayNanoseconds()가 없는
+    // policy는 밀리초 단위로 올림
+    template<typename Rep, typename Period>
+    static void delayFor(std::chrono::duration<Rep, Period> duration) {
+        auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+        if (ns <= 0) {
+            return;
+        }
+        if constexpr (HasPreciseDelay<TimePolicy>::value) {
+            TimePolicy::delayNanoseconds(static_cast<std::uint64_t>(ns));
+        } else {
+            std::this_thread::sleep_for(std::chrono::ceil<std::chrono::milliseconds>(duration));
+        }
+    }
+
+    // Get current time in nanoseconds (nanosecond policies only)
+    // 현재 시간을 나노초 단위로 얻기 (나노초 policy 전용)
+    static std::uint64_t nanos() {
+        static_assert(kHighResolution, "TimePolicy has no getNanoseconds()");
+        return TimePolicy::getNanoseconds();
+    }
+
+    // Measure elapsed time for a task, in whole milliseconds
+    // 작업의 경과 시간 측정 (밀리초 단위)
+    // The unsigned difference stays correct when the 32-bit millisecond counter wraps
+    // 32-bit 밀리초 counter가 wrap되어도 unsigned 차이는 올바름
+    static uint32_t measureElapsed(void (*task)()) {
+        uint32_t start = millis();
+        task();
+        uint32_t end = millis();
+        return end - start;
+    }
+
+    // Measure elapsed time for any callable with arguments, as a std::chrono::duration
+    // 인자를 받는 임의의 callable의 경과 시간을 std::chrono::duration으로 측정
+    // A plain function with no template arguments still picks the millisecond
+    // overload above, so name the duration: measureElapsed<std::chrono::microseconds>(sampleTask)
+    // Template 인자 없는 일반 함수는 여전히 위의 밀리초 overload를 선택하므로 duration을
+    // 지정해야 함: measureElapsed<std::chrono::microseconds>(sampleTask)
+    template<typename Duration = std::chrono::nanoseconds, typename Task, typename... Args>
+    static Duration measureElapsed(Task&& task, Args&&... args) {
+        if constexpr (kHighResolution) {
+            std::uint64_t start = TimePolicy::getNanoseconds();
+            std::invoke(std::forward<Task>(task), std::forward<Args>(args)...);
+            std::uint64_t end = TimePolicy::getNanoseconds();
+            return std::chrono::duration_cast<Duration>(std::chrono::nanoseconds(end - start));
+        } else {
+            uint32_t start = millis();
+            std::invoke(std::forward<Task>(task), std::forward<Args>(args)...);
+            uint32_t end = millis();
+            return std::chrono::duration_cast<Duration>(std::chrono::milliseconds(end - start));
+        }
+    }
+};
+
+#endif // COMMON_SYSTEM_TIMER_H
@@ -0,0 +1,254 @@
+#ifndef COMMON_THREAD_POOL_H
+#define COMMON_THREAD_POOL_H
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Reusable thread pool with one work-stealing deque per worker
+// Worker마다 work-stealing deque를 하나씩 가지는 재사용 가능한 thread pool
+//
+// A worker pops its own deque from the back (LIFO, cache-friendly) and steals
+// from the front of the other deques when its own deque is empty. Threads are
+// created once in the constructor and joined in the destructor, so submitting
+// a task never pays thread creation or teardown.
+// Worker는 자신의 deque 뒤쪽에서 꺼내고 (LIFO, cache 친화적), 자신의 deque가 비면
+// 다른 deque의 앞쪽에서 훔쳐옴. Thread는 constructor에서 한 번 생성되고 destructor에서
+// join되므로 task 제출 시 thread 생성/소멸 비용이 들지 않음.
+class ThreadPool {
+public:
+    explicit ThreadPool(unsigned numThreads = defaultThreadCount()) {
+        if (numThreads == 0) {
+            numThreads = 1;
+        }
+        for (unsigned i = 0; i < numThreads; ++i) {
+            queues.emplace_back(new WorkQueue);
+        }
+        for (unsigned i = 0; i < numThreads; ++i) {
+            workers.emplace_back(&ThreadPool::workerLoop, this, i);
+        }
+    }
+
+    // Finish every queued task, then join the workers
+    // 대기 중인 모든 task를 끝낸 뒤 worker를 join
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(sleepMutex);
+            stopping = true;
+        }
+        wakeUp.notify_all();
+        for (auto& t : workers) {
+            t.join();
+        }
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    static unsigned defaultThreadCount() {
+        unsigned n = std::thread::hardware_concurrency();
+        return n == 0 ? 1 : n;
+    }
+
+    unsigned size() const {
+        return static_cast<unsigned>(workers.size());
+    }
+
+    // Queue a callable and return a future for its result
+    // Callable을 queue에 넣고 그 결과에 대한 future를 반환
+    template<typename F>
+    auto submit(F&& f) -> std::future<decltype(f())> {
+        using Result = decltype(f());
+        // packaged_task is move-only, so share it to fit in std::function
+        // packaged_task는 move-only이므로 std::function에 넣기 위해 공유
+        auto task = std::make_shared<std::packaged_task<Result()>>(std::forward<F>(f));
+        std::future<Result> result = task->get_future();
+        push([task]() { (*task)(); });
+        return result;
+    }
+
+    // Call body(i) for every i in [begin, end), split into chunks across workers
+    // [begin, end)의 모든 i에 대해 body(i)를 호출하며, chunk로 나누어 worker에 분배
+    //
+    // The calling thread runs queued tasks while it waits, so parallel_for can
+    // be nested inside a task without deadlocking the pool.
+    // 호출한 thread도 대기하는 동안 queue의 task를 실행하므로, task 안에서
+    // parallel_for를 중첩 호출해도 pool이 deadlock에 빠지지 않음.
+    template<typename F>
+    void parallel_for(std::size_t begin, std::size_t end, F body) {
+        if (begin >= end) {
+            return;
+        }
+        std::size_t count = end - begin;
+        std::size_t numChunks = std::min<std::size_t>(count, size() * 4);
+        std::size_t chunkSize = (count + numChunks - 1) / numChunks;
+
+        std::vector<std::future<void>> chunks;
+        for (std::size_t lo = begin; lo < end; lo += chunkSize) {
+            std::size_t hi = std::min(end, lo + chunkSize);
+            chunks.push_back(submit([&body, lo, hi]() {
+                for (std::size_t i = lo; i < hi; ++i) {
+                    body(i);
+                }
+            }));
+        }
+
+        // Every chunk refers to body, so wait for all of them before rethrowing
+        // 모든 chunk가 body를 참조하므로, 다시 throw하기 전에 모두 끝날 때까지 기다림
+        std::exception_ptr error;
+        for (auto& chunk : chunks) {
+            while (chunk.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+                if (!runPendingTask()) {
+                    std::this_thread::yield();
+                }
+            }
+            try {
+                chunk.get();
+            } catch (...) {
+                if (!error) {
+                    error = std::current_exception();
+                }
+            }
+        }
+        if (error) {
+            std::rethrow_exception(error); // The first exception thrown by body
+                                           // body에서 처음 발생한 exception
+        }
+    }
+
+    // Run one queued task on the calling thread; returns false if none was found
+    // 호출한 thread에서 queue의 task 하나를 실행; 찾지 못하면 false 반환
+    bool runPendingTask() {
+        Task task;
+        if (!popTask(task, localIndex())) {
+            return false;
+        }
+        task();
+        return true;
+    }
+
+private:
+    using Task = std::function<void()>;
+
+    struct WorkQueue {
+        std::mutex mtx;
+        std::deque<Task> tasks;
+    };
+
+    enum : unsigned { kNoIndex = ~0u };
+
+    std::vector<std::unique_ptr<WorkQueue>> queues;
+    std::vector<std::thread> workers;
+
+    std::atomic<std::size_t> pending{0};    // Tasks sitting in any deque
+                                            // 어느 deque에든 들어 있는 task 수
+    std::atomic<unsigned> nextQueue{0};     // Round-robin target for external submits
+                                            // 외부 제출을 위한 round-robin 대상
+    std::atomic<int> sleepers{0};           // Workers blocked on wakeUp
+                                            // wakeUp에서 대기 중인 worker 수
+    std::mutex sleepMutex;
+    std::condition_variable wakeUp;
+    bool stopping = false;
+
+    // Identifies the pool and deque owned by the current thread, if any
+    // 현재 thread가 소유한 pool과 deque를 식별 (있는 경우)
+    struct WorkerInfo {
+        const ThreadPool* pool = nullptr;
+        unsigned index = kNoIndex;
+    };
+
+    static WorkerInfo& workerInfo() {
+        thread_local WorkerInfo info;
+        return info;
+    }
+
+    unsigned localIndex() const {
+        const WorkerInfo& info = workerInfo();
+        return info.pool == this ? info.index : kNoIndex;
+    }
+
+    void push(Task task) {
+        // Workers push to their own deque; other threads spread round-robin
+        // Worker는 자신의 deque에, 다른 thread는 round-robin으로 분배
+        unsigned index = localIndex();
+        if (index == kNoIndex) {
+            index = nextQueue.fetch_add(1, std::memory_order_relaxed) % queues.size();
+        }
+        {
+            std::lock_guard<std::mutex> lock(queues[index]->mtx);
+            queues[index]->tasks.push_back(std::move(task));
+        }
+        pending.fetch_add(1);
+
+        // Only pay for the condition variable when a worker is asleep
+        // Worker가 잠들어 있을 때만 condition variable 비용을 지불
+        if (sleepers.load() > 0) {
+            { std::lock_guard<std::mutex> lock(sleepMutex); }
+            wakeUp.notify_one();
+        }
+    }
+
+    bool popTask(Task& out, unsigned self) {
+        // Own deque first, newest task first
+        // 자신의 deque를 먼저, 가장 최근 task부터
+        if (self != kNoIndex) {
+            WorkQueue& own = *queues[self];
+            std::lock_guard<std::mutex> lock(own.mtx);
+            if (!own.tasks.empty()) {
+                out = std::move(own.tasks.back());
+                own.tasks.pop_back();
+                pending.fetch_sub(1);
+                return true;
+            }
+        }
+
+        // Steal the oldest task from another deque
+        // 다른 deque에서 가장 오래된 task를 훔쳐옴
+        std::size_t n = queues.size();
+        std::size_t start = (self == kNoIndex) ? 0 : self + 1;
+        for (std::size_t i = 0; i < n; ++i) {
+            WorkQueue& victim = *queues[(start + i) % n];
+            std::lock_guard<std::mutex> lock(victim.mtx);
+            if (!victim.tasks.empty()) {
+                out = std::move(victim.tasks.front());
+                victim.tasks.pop_front();
+                pending.fetch_sub(1);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void workerLoop(unsigned index) {
+        workerInfo().pool = this;
+        workerInfo().index = index;
+
+        while (true) {
+            Task task;
+            if (popTask(task, index)) {
+                task();
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(sleepMutex);
+            ++sleepers;
+            wakeUp.wait(lock, [this]() { return stopping || pending.load() > 0; });
+            --sleepers;
+            if (stopping && pending.load() == 0) {
+                return;
+            }
+        }
+    }
+};
+
+#endif // COMMON_THREAD_POOL_H
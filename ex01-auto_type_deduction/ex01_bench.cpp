@@ -0,0 +1,42 @@
+#include <string>
+#include <vector>
+
+#include "benchmark.h"
+
+// Elements iterated per run; the strings are long enough that a copy allocates
+// 실행마다 순회하는 요소 수; string은 복사 시 할당이 일어날 만큼 긺
+constexpr int kElements = 100000;
+
+int main(int argc, char* argv[]) {
+    auto bench = Benchmark<>::fromArgs(argc, argv);
+
+    auto texts = std::vector<std::string>(kElements, std::string("Hello, World! auto deduces a copy"));
+    auto numbers = std::vector<int>(kElements, 42);
+
+    // auto drops references and const, so "auto text" copies every string
+    // auto는 reference와 const를 제거하므로 "auto text"는 모든 string을 복사함
+    bench.section("Range-for over " + std::to_string(kElements) + " elements, ns per element");
+    bench.run("std::string, auto", [&texts]() {
+        for (auto text : texts) {
+            doNotOptimize(text);
+        }
+    }, kElements);
+    bench.run("std::string, const auto&", [&texts]() {
+        for (const auto& text : texts) {
+            doNotOptimize(text);
+        }
+    }, kElements);
+    bench.run("int, auto", [&numbers]() {
+        for (auto number : numbers) {
+            doNotOptimize(number);
+        }
+    }, kElements);
+    bench.run("int, const auto&", [&numbers]() {
+        for (const auto& number : numbers) {
+            doNotOptimize(number);
+        }
+    }, kElements);
+
+    bench.report();
+    return 0;
+}
@@ -0,0 +1,54 @@
+#include <memory>
+
+#include "benchmark.h"
+
+// MyClass without the console output, so only ownership is measured
+// Console 출력이 없는 MyClass, ownership 비용만 측정함
+class MyClass {
+public:
+    int value = 0;
+};
+
+int main(int argc, char* argv[]) {
+    auto bench = Benchmark<>::fromArgs(argc, argv);
+
+    // Create and destroy one object per iteration
+    // Iteration마다 객체 하나를 생성하고 파괴
+    bench.section("Create and destroy, ns per object");
+    bench.run("new/delete", []() {
+        MyClass* raw = new MyClass();
+        doNotOptimize(raw);
+        delete raw;
+    });
+    bench.run("std::make_unique", []() {
+        auto uniquePtr = std::make_unique<MyClass>();
+        doNotOptimize(uniquePtr);
+    });
+    bench.run("std::shared_ptr(new)", []() {
+        std::shared_ptr<MyClass> sharedPtr(new MyClass()); // Object and control block: two allocations
+                                                           // 객체와 control block: 두 번의 할당
+        doNotOptimize(sharedPtr);
+    });
+    bench.run("std::make_shared", []() {
+        auto sharedPtr = std::make_shared<MyClass>(); // One allocation for both
+                                                      // 둘을 한 번에 할당
+        doNotOptimize(sharedPtr);
+    });
+
+    // Copying a shared_ptr changes the reference count atomically
+    // shared_ptr 복사는 reference count를 atomic하게 변경함
+    bench.section("Copy, ns per copy");
+    auto sharedPtr1 = std::make_shared<MyClass>();
+    bench.run("shared_ptr copy", [&sharedPtr1]() {
+        auto sharedPtr2 = sharedPtr1;
+        doNotOptimize(sharedPtr2);
+    });
+    MyClass* raw = sharedPtr1.get();
+    bench.run("raw pointer copy", [raw]() {
+        MyClass* copy = raw;
+        doNotOptimize(copy);
+    });
+
+    bench.report();
+    return 0;
+}
@@ -0,0 +1,47 @@
+#include <memory>
+
+#include "benchmark.h"
+
+// MyClass without the console output
+// Console 출력이 없는 MyClass
+class MyClass {
+public:
+    int value = 1;
+};
+
+// Three ways to hand a shared object to a function. Taking the shared_ptr by
+// value copies it; a const reference or the raw pointer from get() does not
+// touch the reference count, and get() is safe as long as nobody deletes it.
+// 공유 객체를 함수에 넘기는 세 가지 방법. shared_ptr을 값으로 받으면 복사가 일어나고,
+// const reference나 get()의 raw pointer는 reference count를 건드리지 않음. get()은
+// 아무도 delete하지 않는 한 안전함.
+__attribute__((noinline)) int byValue(std::shared_ptr<MyClass> ptr) {
+    return ptr->value;
+}
+
+__attribute__((noinline)) int byConstRef(const std::shared_ptr<MyClass>& ptr) {
+    return ptr->value;
+}
+
+__attribute__((noinline)) int byRawPointer(const MyClass* ptr) {
+    return ptr->value;
+}
+
+int main(int argc, char* argv[]) {
+    auto bench = Benchmark<>::fromArgs(argc, argv);
+
+    auto sharedPtr1 = std::make_shared<MyClass>();
+    bench.section("Passing a shared object to a function, ns per call");
+    bench.run("shared_ptr by value", [&sharedPtr1]() {
+        doNotOptimize(byValue(sharedPtr1));
+    });
+    bench.run("const shared_ptr&", [&sharedPtr1]() {
+        doNotOptimize(byConstRef(sharedPtr1));
+    });
+    bench.run("raw pointer from get()", [&sharedPtr1]() {
+        doNotOptimize(byRawPointer(sharedPtr1.get()));
+    });
+
+    bench.report();
+    return 0;
+}
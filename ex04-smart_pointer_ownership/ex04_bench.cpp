@@ -0,0 +1,42 @@
+#include <memory>
+#include <utility>
+
+#include "benchmark.h"
+
+// MyClass without the console output
+// Console 출력이 없는 MyClass
+class MyClass {
+public:
+    int value = 0;
+};
+
+int main(int argc, char* argv[]) {
+    auto bench = Benchmark<>::fromArgs(argc, argv);
+
+    // Ownership moves back and forth between two pointers once per iteration
+    // Iteration마다 ownership이 두 pointer 사이를 한 번 이동함
+    bench.section("Ownership transfer, ns per transfer");
+    std::unique_ptr<MyClass> unique1(new MyClass());
+    std::unique_ptr<MyClass> unique2;
+    bench.run("unique_ptr move", [&unique1, &unique2]() {
+        unique2 = std::move(unique1);
+        unique1 = std::move(unique2);
+        clobberMemory();
+    }, 2);
+    std::shared_ptr<MyClass> shared1(new MyClass());
+    std::shared_ptr<MyClass> shared2;
+    bench.run("shared_ptr move", [&shared1, &shared2]() {
+        shared2 = std::move(shared1);
+        shared1 = std::move(shared2);
+        clobberMemory();
+    }, 2);
+    bench.run("shared_ptr copy and reset", [&shared1, &shared2]() {
+        shared2 = shared1; // Shared, not transferred: the count goes up and down
+                           // 이전이 아니라 공유: count가 증가했다가 감소함
+        shared2.reset();
+        clobberMemory();
+    });
+
+    bench.report();
+    return 0;
+}
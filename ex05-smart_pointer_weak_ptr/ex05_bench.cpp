@@ -0,0 +1,57 @@
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "benchmark.h"
+
+// Node without the console output
+// Console 출력이 없는 Node
+class Node {
+public:
+    std::shared_ptr<Node> next;
+    std::weak_ptr<Node> prev; // Use weak_ptr to prevent circular reference
+                              // weak_ptr을 사용하여 순환 참조 방지
+};
+
+// Nodes in the list built per iteration
+// Iteration마다 만드는 list의 node 수
+constexpr int kNodes = 1000;
+
+int main(int argc, char* argv[]) {
+    auto bench = Benchmark<>::fromArgs(argc, argv);
+
+    auto node1 = std::make_shared<Node>();
+    auto node2 = std::make_shared<Node>();
+    node1->next = node2;
+    node2->prev = node1;
+
+    // Following a weak link means lock(): check the object is alive and take a reference
+    // Weak link를 따라가려면 lock()이 필요함: 객체가 살아 있는지 확인하고 reference를 얻음
+    bench.section("Following a link, ns per access");
+    bench.run("weak_ptr::lock", [&node2]() {
+        auto prev = node2->prev.lock();
+        doNotOptimize(prev);
+    });
+    bench.run("shared_ptr copy", [&node1]() {
+        auto next = node1->next;
+        doNotOptimize(next);
+    });
+
+    // Build a doubly linked list and let it go; releasing the head frees every node
+    // 이중 linked list를 만들고 놓음; head를 해제하면 모든 node가 해제됨
+    bench.section("Build and release a " + std::to_string(kNodes) + "-node list, ns per node");
+    bench.run("shared next, weak prev", []() {
+        auto head = std::make_shared<Node>();
+        auto tail = head;
+        for (int i = 1; i < kNodes; ++i) {
+            auto node = std::make_shared<Node>();
+            node->prev = tail;
+            tail->next = node;
+            tail = std::move(node);
+        }
+        doNotOptimize(head);
+    }, kNodes);
+
+    bench.report();
+    return 0;
+}
@@ -2,6 +2,8 @@
 #include <thread>
 #include <chrono>
 
+#include "thread_pool.h"
+
 int main() {
     // Define a lambda function for thread 1
     // Thread 1을 위한 lambda function 정의
@@ -23,15 +25,19 @@ int main() {
         }
     };
 
-    std::thread t1(say_hello);   // Create and execute first thread
-                                 // 첫 번째 thread 생성 및 실행
-    std::thread t2(say_goodbye); // Create and execute second thread
-                                 // 두 번째 thread 생성 및 실행
+    // Create a pool with two reusable worker threads
+    // 재사용 가능한 worker thread 두 개를 가진 pool 생성
+    ThreadPool pool(2);
+
+    auto hello = pool.submit(say_hello);     // Run first task on a pool worker
+                                             // 첫 번째 task를 pool worker에서 실행
+    auto goodbye = pool.submit(say_goodbye); // Run second task on a pool worker
+                                             // 두 번째 task를 pool worker에서 실행
 
-    t1.join(); // Main thread waits for t1 to finish
-               // Main thread가 t1 thread 종료를 대기
-    t2.join(); // Main thread waits for t2 to finish
-               // Main thread가 t2 thread 종료를 대기
+    hello.get();   // Main thread waits for the first task to finish
+                   // Main thread가 첫 번째 task 종료를 대기
+    goodbye.get(); // Main thread waits for the second task to finish
+                   // Main thread가 두 번째 task 종료를 대기
 
     return 0;
 }
\ No newline at end of file
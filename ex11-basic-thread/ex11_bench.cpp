@@ -0,0 +1,119 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <future>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "benchmark.h"
+#include "thread_pool.h"
+
+using Clock = std::chrono::steady_clock;
+
+// Tasks per pool iteration, and tasks for the latency measurement
+// Pool iteration당 task 수와 지연 시간 측정에 사용하는 task 수
+constexpr int kPoolBatch = 1000;
+constexpr int kLatencyTasks = 10000;
+
+// Trivial task body so the measurement is dominated by dispatch cost
+// 측정이 dispatch 비용에 의해 좌우되도록 하는 간단한 task
+std::atomic<long> sink{0};
+
+void tinyTask() {
+    sink.fetch_add(1, std::memory_order_relaxed);
+}
+
+// Print p50/p99/max of a list of latencies in microseconds
+// 지연 시간 목록의 p50/p99/max를 microsecond 단위로 출력
+void printLatency(const char* name, std::vector<double>& micros) {
+    std::sort(micros.begin(), micros.end());
+    auto at = [&micros](double q) {
+        return micros[static_cast<std::size_t>(q * (micros.size() - 1))];
+    };
+    std::cout << std::setw(16) << name << std::fixed << std::setprecision(2)
+              << std::setw(12) << at(0.50)
+              << std::setw(12) << at(0.99)
+              << std::setw(12) << micros.back() << std::endl;
+}
+
+// Throughput: one iteration submits a batch of tasks and waits for all of them
+// 처리량: iteration 하나가 task batch를 제출하고 모두 끝날 때까지 대기
+void poolBatch(ThreadPool& pool, std::vector<std::future<void>>& futures) {
+    futures.clear();
+    for (int i = 0; i < kPoolBatch; ++i) {
+        futures.push_back(pool.submit(tinyTask));
+    }
+    for (auto& f : futures) {
+        f.get();
+    }
+}
+
+void spawnOne() {
+    std::thread t(tinyTask);
+    t.join();
+}
+
+// Latency: time from dispatch until the task starts running
+// 지연 시간: dispatch부터 task가 실행을 시작할 때까지의 시간
+std::vector<double> poolLatency(ThreadPool& pool) {
+    std::vector<double> micros;
+    for (int i = 0; i < kLatencyTasks; ++i) {
+        auto dispatched = Clock::now();
+        auto started = pool.submit([]() { return Clock::now(); }).get();
+        micros.push_back(std::chrono::duration<double, std::micro>(started - dispatched).count());
+    }
+    return micros;
+}
+
+std::vector<double> spawnLatency() {
+    std::vector<double> micros;
+    for (int i = 0; i < kLatencyTasks; ++i) {
+        Clock::time_point started;
+        auto dispatched = Clock::now();
+        std::thread t([&started]() { started = Clock::now(); });
+        t.join();
+        micros.push_back(std::chrono::duration<double, std::micro>(started - dispatched).count());
+    }
+    return micros;
+}
+
+int main(int argc, char* argv[]) {
+    // Harness options (--format=csv, --samples=N, ...) are removed from argv
+    // Harness option (--format=csv, --samples=N, ...)은 argv에서 제거됨
+    auto bench = Benchmark<>::fromArgs(argc, argv);
+
+    // Worker count: first argument, or the number of hardware threads
+    // Worker 수: 첫 번째 인자 또는 hardware thread 수
+    unsigned numThreads = ThreadPool::defaultThreadCount();
+    if (argc > 1) {
+        numThreads = static_cast<unsigned>(std::atoi(argv[1]));
+    }
+
+    ThreadPool pool(numThreads);
+    bench.note("Thread pool workers: " + std::to_string(pool.size()));
+
+    bench.section("Task dispatch throughput, ns per task");
+    std::vector<std::future<void>> futures;
+    futures.reserve(kPoolBatch);
+    bench.run("pool", [&]() { poolBatch(pool, futures); }, kPoolBatch);
+    bench.run("spawn-per-task", spawnOne);
+
+    // Per-task latencies are timed one by one, so they stay out of the CSV/JSON report
+    // Task별 지연 시간은 하나씩 측정하므로 CSV/JSON report에는 포함하지 않음
+    if (bench.reportFormat() == ReportFormat::Table) {
+        std::cout << "\nDispatch latency (us)" << std::endl;
+        std::cout << std::setw(16) << "mode" << std::setw(12) << "p50"
+                  << std::setw(12) << "p99" << std::setw(12) << "max" << std::endl;
+        std::vector<double> pooled = poolLatency(pool);
+        std::vector<double> spawned = spawnLatency();
+        printLatency("pool", pooled);
+        printLatency("spawn-per-task", spawned);
+    }
+
+    bench.report();
+    return 0;
+}
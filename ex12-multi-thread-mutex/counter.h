@@ -0,0 +1,98 @@
+#ifndef EX12_COUNTER_H
+#define EX12_COUNTER_H
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+
+#include "instrument.h"
+
+// Size of one cache line on x86-64 and most ARM cores
+// x86-64와 대부분의 ARM core에서 cache line 하나의 크기
+constexpr std::size_t kCacheLineSize = 64;
+
+// Counter protected by a single mutex (the original ex12 approach)
+// 단일 mutex로 보호되는 counter (기존 ex12 방식)
+class MutexCounter {
+private:
+    long count = 0;
+    mutable std::mutex mtx;
+
+public:
+    void increment() {
+        INSTRUMENT_SCOPE("MutexCounter::increment"); // Lock wait plus the critical section
+                                                      // Lock 대기와 임계 구역
+        std::lock_guard<std::mutex> lock(mtx); // Every thread serializes here
+                                                // 모든 thread가 여기서 직렬화됨
+        ++count;
+    }
+
+    long value() const {
+        std::lock_guard<std::mutex> lock(mtx);
+        return count;
+    }
+};
+
+// Counter using a single atomic fetch_add (no lock, but one shared cache line)
+// 단일 atomic fetch_add를 사용하는 counter (lock은 없지만 cache line 하나를 공유)
+class AtomicCounter {
+private:
+    std::atomic<long> count{0};
+
+public:
+    void increment() {
+        count.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    long value() const {
+        return count.load(std::memory_order_relaxed);
+    }
+};
+
+// Counter split into per-thread shards, each on its own cache line
+// Thread별 shard로 나뉜 counter, 각 shard는 자신만의 cache line에 위치
+//
+// Writers only touch their own shard, so increments never bounce a cache
+// line between cores. value() sums all shards and is therefore a snapshot
+// that is exact once all writers have finished.
+// Writer는 자신의 shard만 수정하므로 core 사이에서 cache line이 오가지 않음.
+// value()는 모든 shard를 합산하므로, 모든 writer가 끝난 뒤에는 정확한 값을 반환함.
+template<std::size_t NumShards = 64>
+class ShardedCounter {
+private:
+    // One shard padded to a full cache line to avoid false sharing
+    // False sharing을 피하기 위해 cache line 전체 크기로 padding된 shard
+    struct alignas(kCacheLineSize) Shard {
+        std::atomic<long> count{0};
+    };
+
+    Shard shards[NumShards];
+
+    // Each thread is assigned a shard index the first time it increments
+    // 각 thread는 처음 increment할 때 shard index를 할당받음
+    static std::size_t shardIndex() {
+        static std::atomic<std::size_t> nextIndex{0};
+        thread_local std::size_t index =
+            nextIndex.fetch_add(1, std::memory_order_relaxed) % NumShards;
+        return index;
+    }
+
+public:
+    void increment() {
+        // fetch_add keeps the counter correct if more threads than shards
+        // share an index; uncontended it stays on the local cache line
+        // Shard보다 thread가 많아 index가 겹쳐도 fetch_add로 정확성 유지;
+        // 경합이 없으면 local cache line에서만 동작함
+        shards[shardIndex()].count.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    long value() const {
+        long sum = 0;
+        for (const auto& shard : shards) {
+            sum += shard.count.load(std::memory_order_relaxed);
+        }
+        return sum;
+    }
+};
+
+#endif // EX12_COUNTER_H
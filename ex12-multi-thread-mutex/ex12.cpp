@@ -1,35 +1,48 @@
 #include <iostream>
-#include <thread>
-#include <vector>
-#include <mutex>
 
-void increment(int& counter, std::mutex& mtx) {
+#include "counter.h"
+#include "thread_pool.h"
+
+// Increment any counter type that provides increment()
+// increment()를 제공하는 모든 counter type을 증가
+template<typename Counter>
+void increment(Counter& counter) {
     for (int i = 0; i < 10000; ++i) {
-        std::lock_guard<std::mutex> lock(mtx); // Synchronize using mutex
-                                                // mutex를 사용하여 동기화
-        ++counter; // Safely increment counter
-                   // 안전하게 counter 증가
+        counter.increment(); // Synchronization is handled by the counter
+                             // 동기화는 counter가 처리
     }
 }
 
-int main() {
-    int counter = 0; // Shared resource
+// Run 10 increment tasks on the pool against one counter and print the final value
+// Pool에서 하나의 counter에 대해 10개의 increment task를 실행하고 최종 값을 출력
+template<typename Counter>
+void runCounter(ThreadPool& pool, const char* name) {
+    Counter counter; // Shared resource
                      // 공유 resource
-    std::mutex mtx;  // Mutex object
-                     // Mutex 객체
 
-    std::vector<std::thread> threads;
-    for (int i = 0; i < 10; ++i) {
-        threads.emplace_back(increment, std::ref(counter), std::ref(mtx)); // Create multiple threads
-                                                                            // 여러 thread 생성
-    }
+    // Each index is one task; the pool reuses its workers for every counter
+    // 각 index가 하나의 task; pool은 모든 counter에 대해 worker를 재사용
+    pool.parallel_for(0, 10, [&counter](std::size_t) {
+        increment(counter);
+    }); // Returns after all tasks have finished
+        // 모든 task가 끝난 뒤 반환
 
-    for (auto& t : threads) {
-        t.join(); // Wait for all threads to finish
-                  // 모든 thread가 종료될 때까지 대기
-    }
+    std::cout << name << " final counter value: " << counter.value() << std::endl;
+}
 
-    std::cout << "Final counter value: " << counter << std::endl;
+int main(int argc, char* argv[]) {
+    InstrumentTraceSession trace(argc, argv); // --trace=FILE records the mutex section
+                                              // --trace=FILE은 mutex 구역을 기록
+
+    ThreadPool pool(10); // Worker threads are created once and shared
+                         // Worker thread는 한 번 생성되어 공유됨
+
+    runCounter<MutexCounter>(pool, "Mutex");       // One lock shared by every thread
+                                                   // 모든 thread가 하나의 lock을 공유
+    runCounter<AtomicCounter>(pool, "Atomic");     // Lock-free fetch_add on one cache line
+                                                   // 하나의 cache line에서 lock-free fetch_add
+    runCounter<ShardedCounter<>>(pool, "Sharded"); // Per-thread padded shards summed on read
+                                                   // Thread별 padding된 shard를 읽을 때 합산
 
     return 0;
-}
\ No newline at end of file
+}
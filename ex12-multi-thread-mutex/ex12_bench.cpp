@@ -0,0 +1,73 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "benchmark.h"
+#include "counter.h"
+
+// Number of increments each thread performs per iteration
+// Iteration마다 각 thread가 수행하는 increment 횟수
+constexpr long kIncrementsPerThread = 100000;
+
+// One iteration: numThreads threads increment one counter, then the total is checked
+// Iteration 하나: numThreads개의 thread가 하나의 counter를 증가시킨 뒤 합계를 확인
+template<typename Counter>
+void incrementAll(unsigned numThreads) {
+    Counter counter;
+
+    std::vector<std::thread> threads;
+    for (unsigned i = 0; i < numThreads; ++i) {
+        threads.emplace_back([&counter]() {
+            for (long n = 0; n < kIncrementsPerThread; ++n) {
+                counter.increment();
+            }
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    // Verify the reader sees every increment
+    // Reader가 모든 increment를 보는지 확인
+    if (counter.value() != kIncrementsPerThread * static_cast<long>(numThreads)) {
+        std::cerr << "Counter mismatch: " << counter.value() << std::endl;
+        std::exit(1);
+    }
+}
+
+int main(int argc, char* argv[]) {
+    // Harness options (--format=csv, --samples=N, ...) are removed from argv
+    // Harness option (--format=csv, --samples=N, ...)은 argv에서 제거됨
+    auto bench = Benchmark<>::fromArgs(argc, argv);
+
+    // Maximum thread count: first argument, or the number of hardware threads
+    // 최대 thread 수: 첫 번째 인자 또는 hardware thread 수
+    unsigned maxThreads = std::thread::hardware_concurrency();
+    if (argc > 1) {
+        maxThreads = static_cast<unsigned>(std::atoi(argv[1]));
+    }
+    if (maxThreads == 0) {
+        maxThreads = 1;
+    }
+
+    // Every iteration starts threads, so fewer and longer samples are enough
+    // 매 iteration이 thread를 시작하므로 더 적고 긴 sample로 충분함
+    BenchmarkOptions options = bench.defaults();
+    options.samples = std::min(options.samples, 15);
+    options.minSampleTime = std::max<std::chrono::nanoseconds>(options.minSampleTime, std::chrono::milliseconds(20));
+
+    for (unsigned n = 1; n <= maxThreads; ++n) {
+        bench.section("Counter increments, " + std::to_string(n) + " thread(s), ns per increment");
+        double items = static_cast<double>(kIncrementsPerThread) * n;
+        bench.run("mutex", options, [n]() { incrementAll<MutexCounter>(n); }, items);
+        bench.run("atomic", options, [n]() { incrementAll<AtomicCounter>(n); }, items);
+        bench.run("sharded", options, [n]() { incrementAll<ShardedCounter<>>(n); }, items);
+    }
+
+    bench.report();
+    return 0;
+}
@@ -0,0 +1,51 @@
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "benchmark.h"
+
+// Values passed through each callable per iteration
+// Iteration마다 각 callable에 전달하는 값의 수
+constexpr int kValues = 1024;
+
+int square(int n) {
+    return n * n;
+}
+
+// Apply f to every value; the callable type decides how the call is made
+// 모든 값에 f를 적용; callable의 type이 호출 방식을 결정함
+template<typename F>
+long applyAll(const std::vector<int>& values, F f) {
+    long sum = 0;
+    for (int value : values) {
+        sum += f(value);
+    }
+    return sum;
+}
+
+int main(int argc, char* argv[]) {
+    auto bench = Benchmark<>::fromArgs(argc, argv);
+
+    std::vector<int> values(kValues);
+    for (int i = 0; i < kValues; ++i) {
+        values[i] = i;
+    }
+
+    // A lambda has its own type, so the call can be inlined; std::function and
+    // a function pointer hide the target behind an indirect call
+    // Lambda는 고유한 type을 가지므로 호출이 inline될 수 있음; std::function과 function
+    // pointer는 대상을 간접 호출 뒤에 숨김
+    auto lambda = [](int n) { return n * n; };
+    std::function<int(int)> function = lambda;
+    int (*volatile pointerSlot)(int) = square; // volatile keeps the target unknown to the compiler
+                                               // volatile은 compiler가 대상을 알 수 없게 함
+    int (*pointer)(int) = pointerSlot;
+
+    bench.section("Calling a callable " + std::to_string(kValues) + " times, ns per call");
+    bench.run("lambda", [&]() { doNotOptimize(applyAll(values, lambda)); }, kValues);
+    bench.run("std::function", [&]() { doNotOptimize(applyAll(values, function)); }, kValues);
+    bench.run("function pointer", [&]() { doNotOptimize(applyAll(values, pointer)); }, kValues);
+
+    bench.report();
+    return 0;
+}
@@ -1,6 +1,9 @@
 #include <iostream>
 #include <vector>
 #include <algorithm>
+#include <functional>
+
+#include "pipeline.h"
 
 int main() {
     // Initialize a vector with some numbers
@@ -31,5 +34,34 @@ int main() {
     // Vector의 각 요소에 lambda를 적용
     std::for_each(numbers.begin(), numbers.end(), check_threshold);
 
+    // The same filter as a lazy pipeline: the stages only run when collect() asks,
+    // and the printing happens afterwards, outside the loop
+    // Lazy pipeline으로 작성한 같은 filter: stage는 collect()가 요청할 때만 실행되며,
+    // 출력은 그 뒤 loop 밖에서 함
+    auto greater = [threshold](int n) { return n > threshold; };
+    std::vector<int> matches = from(numbers) | filter(greater) | collect();
+    std::cout << "\nCollected by the pipeline:";
+    for (int n : matches) {
+        std::cout << " " << n;
+    }
+    std::cout << "\n";
+
+    // Filter, map and reduce fused into one loop
+    // Filter, map, reduce가 하나의 loop로 합쳐짐
+    auto square = [](int n) { return n * n; };
+    int sumOfSquares = from(numbers) | filter(greater) | map(square) | reduce(0, std::plus<int>());
+    std::cout << "Sum of their squares: " << sumOfSquares << "\n";
+
+    // The same pipeline split into chunks across a thread pool
+    // Thread pool에 chunk로 나누어 실행하는 같은 pipeline
+    ThreadPool pool(2);
+    std::vector<int> many(1000);
+    for (int i = 0; i < 1000; ++i) {
+        many[i] = i % 10;
+    }
+    long parallelSum = from(many) | parallel(pool) | filter(greater) | map(square) | reduce(0L, std::plus<long>());
+    std::cout << "Sum of squares above " << threshold << " in 1000 numbers, on " << pool.size()
+              << " threads: " << parallelSum << "\n";
+
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,115 @@
+#include <algorithm>
+#include <functional>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "benchmark.h"
+#include "pipeline.h"
+
+// Numbers scanned per iteration
+// Iteration마다 검사하는 숫자 수
+constexpr int kNumbers = 1 << 20;
+
+// Numbers in the filter-map-reduce comparison
+// Filter-map-reduce 비교의 숫자 수
+constexpr int kPipelineNumbers = 100000000;
+
+int main(int argc, char* argv[]) {
+    auto bench = Benchmark<>::fromArgs(argc, argv);
+
+    std::vector<int> numbers(kNumbers);
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> pick(0, 9);
+    for (int& n : numbers) {
+        n = pick(rng);
+    }
+    int threshold = 3;
+
+    // The lambda of the example without the output: count instead of print
+    // 출력이 없는 예제의 lambda: 출력 대신 개수를 셈
+    bench.section("Numbers greater than a captured threshold, " + std::to_string(kNumbers)
+                  + " numbers, ns per number");
+    bench.run("for_each, [threshold, &count]", [&]() {
+        long count = 0;
+        std::for_each(numbers.begin(), numbers.end(), [threshold, &count](int n) {
+            if (n > threshold) {
+                ++count;
+            }
+        });
+        doNotOptimize(count);
+    }, kNumbers);
+    bench.run("count_if, [threshold]", [&]() {
+        long count = std::count_if(numbers.begin(), numbers.end(), [threshold](int n) { return n > threshold; });
+        doNotOptimize(count);
+    }, kNumbers);
+    bench.run("range-for loop", [&]() {
+        long count = 0;
+        for (int n : numbers) {
+            if (n > threshold) {
+                ++count;
+            }
+        }
+        doNotOptimize(count);
+    }, kNumbers);
+
+    // Sum of the squares of the numbers above the threshold, written by hand and as pipelines
+    // Threshold보다 큰 숫자의 제곱의 합, 직접 작성한 경우와 pipeline으로 작성한 경우
+    numbers.assign(kPipelineNumbers, 0);
+    for (int& n : numbers) {
+        n = pick(rng);
+    }
+    auto greater = [threshold](int n) { return n > threshold; };
+    auto square = [](int n) { return static_cast<long>(n) * n; };
+    ThreadPool pool;
+
+    long expected = 0;
+    std::for_each(numbers.begin(), numbers.end(), [&](int n) {
+        if (greater(n)) {
+            expected += square(n);
+        }
+    });
+    if ((from(numbers) | filter(greater) | map(square) | reduce(0L, std::plus<long>())) != expected ||
+        (from(numbers) | parallel(pool) | filter(greater) | map(square) | reduce(0L, std::plus<long>())) != expected) {
+        std::cerr << "Pipelines disagree with the hand-written loop" << std::endl;
+        return 1;
+    }
+
+    BenchmarkOptions options = bench.defaults();
+    options.samples = std::min(options.samples, 10);
+
+    bench.section("Filter, square and sum, " + std::to_string(kPipelineNumbers) + " numbers, ns per number");
+    auto handRow = bench.run("for_each, hand-written", options, [&]() {
+        long sum = 0;
+        std::for_each(numbers.begin(), numbers.end(), [threshold, &sum](int n) {
+            if (n > threshold) {
+                sum += static_cast<long>(n) * n;
+            }
+        });
+        doNotOptimize(sum);
+    }, kPipelineNumbers);
+    auto eagerRow = bench.run("copy_if + transform + accumulate", options, [&]() {
+        std::vector<int> kept;
+        std::copy_if(numbers.begin(), numbers.end(), std::back_inserter(kept), greater);
+        std::vector<long> squares(kept.size());
+        std::transform(kept.begin(), kept.end(), squares.begin(), square);
+        long sum = std::accumulate(squares.begin(), squares.end(), 0L);
+        doNotOptimize(sum);
+    }, kPipelineNumbers);
+    auto fusedRow = bench.run("pipeline", options, [&]() {
+        long sum = from(numbers) | filter(greater) | map(square) | reduce(0L, std::plus<long>());
+        doNotOptimize(sum);
+    }, kPipelineNumbers);
+    auto parallelRow = bench.run("pipeline, parallel on " + std::to_string(pool.size()) + (pool.size() == 1 ? " thread" : " threads"), options, [&]() {
+        long sum = from(numbers) | parallel(pool) | filter(greater) | map(square) | reduce(0L, std::plus<long>());
+        doNotOptimize(sum);
+    }, kPipelineNumbers);
+    bench.noteSpeedup(handRow, eagerRow);
+    bench.noteSpeedup(handRow, fusedRow);
+    bench.noteSpeedup(handRow, parallelRow);
+
+    bench.report();
+    return 0;
+}
@@ -0,0 +1,382 @@
+#ifndef EX22_PIPELINE_H
+#define EX22_PIPELINE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "thread_pool.h"
+
+// Lazy pipeline over a range: from(range) | filter(pred) | map(f) | reduce(init, op)
+// 범위에 대한 lazy pipeline: from(range) | filter(pred) | map(f) | reduce(init, op)
+//
+// filter() and map() only record a stage; nothing runs until a terminal
+// reduce() or collect() is applied. The terminal then wraps the stages
+// around each other from the last to the first, so every element is pushed
+// through all of them in a single loop: no intermediate container is built
+// and, once the lambdas inline, the loop is the one you would write by hand.
+// With parallel(pool) the range is split into chunks that run on the pool;
+// each chunk reduces or collects on its own and the results are combined in
+// chunk order, so collect() keeps the order of the range. Parallel mode is
+// part of the pipeline's type, so a parallel reduce() is checked at compile
+// time: op must also merge two partial results, or a separate combine must be
+// given.
+// filter()와 map()은 stage를 기록만 하며, terminal인 reduce()나 collect()가 적용될
+// 때까지 아무것도 실행되지 않음. Terminal은 stage를 마지막부터 처음까지 서로 감싸므로,
+// 모든 요소는 하나의 loop에서 모든 stage를 통과함: 중간 container가 만들어지지 않으며,
+// lambda가 inline되면 loop는 직접 작성한 것과 같음. parallel(pool)을 사용하면 범위가
+// chunk로 나뉘어 pool에서 실행됨; 각 chunk는 따로 reduce 또는 collect하고 결과는 chunk
+// 순서대로 합쳐지므로 collect()는 범위의 순서를 유지함. 병렬 mode는 pipeline type의
+// 일부이므로 병렬 reduce()는 compile 시 검사됨: op가 두 부분 결과도 합칠 수 있어야 하며,
+// 그렇지 않으면 별도의 combine을 주어야 함.
+
+// No stages yet: passes every element on
+// 아직 stage 없음: 모든 요소를 그대로 넘김
+struct NoStage {
+    template<typename In>
+    using Output = In;
+
+    template<typename Next>
+    Next bind(Next next) const {
+        return next;
+    }
+};
+
+// The stages so far followed by one more
+// 지금까지의 stage 뒤에 하나를 더함
+template<typename Prev, typename Stage>
+struct StageChain {
+    Prev prev;
+    Stage stage;
+
+    template<typename In>
+    using Output = typename Stage::template Output<typename Prev::template Output<In>>;
+
+    template<typename Next>
+    auto bind(Next next) const {
+        return prev.bind(stage.bind(std::move(next)));
+    }
+};
+
+template<typename Predicate>
+struct FilterStage {
+    Predicate predicate;
+
+    template<typename In>
+    using Output = In;
+
+    template<typename Next>
+    auto bind(Next next) const {
+        return [predicate = predicate, next = std::move(next)](auto&& value) mutable {
+            if (predicate(value)) {
+                next(std::forward<decltype(value)>(value));
+            }
+        };
+    }
+};
+
+template<typename Function>
+struct MapStage {
+    Function function;
+
+    template<typename In>
+    using Output = std::decay_t<std::invoke_result_t<const Function&, In>>;
+
+    template<typename Next>
+    auto bind(Next next) const {
+        return [function = function, next = std::move(next)](auto&& value) mutable {
+            next(function(std::forward<decltype(value)>(value)));
+        };
+    }
+};
+
+// Terminals
+// Terminal
+struct CombineWithOp {}; // reduce() without a separate combine
+                         // 별도의 combine이 없는 reduce()
+
+template<typename T, typename Op, typename Combine = CombineWithOp>
+struct ReduceTerminal {
+    T init;
+    Op op;
+    Combine combine;
+};
+
+struct CollectTerminal {};
+
+// Run the terminal on a thread pool
+// Terminal을 thread pool에서 실행
+struct ParallelMode {
+    ThreadPool* pool;
+};
+
+// Parameter types of a callable with one non-template call operator, or void
+// when they are not fixed (generic lambdas, std::plus<>)
+// Template이 아닌 call operator 하나를 가진 callable의 parameter type, 고정되지 않았으면
+// (generic lambda, std::plus<>) void
+template<typename F, typename = void>
+struct CallParameters {
+    using type = void;
+};
+
+template<typename F>
+struct CallParameters<F, std::void_t<decltype(&F::operator())>> : CallParameters<decltype(&F::operator())> {};
+
+template<typename R, typename... A>
+struct CallParameters<R (*)(A...)> {
+    using type = std::tuple<A...>;
+};
+
+template<typename R, typename... A>
+struct CallParameters<R (*)(A...) noexcept> {
+    using type = std::tuple<A...>;
+};
+
+template<typename C, typename R, typename... A>
+struct CallParameters<R (C::*)(A...)> {
+    using type = std::tuple<A...>;
+};
+
+template<typename C, typename R, typename... A>
+struct CallParameters<R (C::*)(A...) const> {
+    using type = std::tuple<A...>;
+};
+
+template<typename C, typename R, typename... A>
+struct CallParameters<R (C::*)(A...) noexcept> {
+    using type = std::tuple<A...>;
+};
+
+template<typename C, typename R, typename... A>
+struct CallParameters<R (C::*)(A...) const noexcept> {
+    using type = std::tuple<A...>;
+};
+
+template<typename T, typename... P>
+constexpr bool allParametersAre(std::tuple<P...>*) {
+    return (std::is_same_v<std::decay_t<P>, T> && ...);
+}
+
+// True if op(T, T) can merge two partial results without converting them
+// op(T, T)가 부분 결과를 변환하지 않고 두 개를 합칠 수 있으면 true
+//
+// Calling op(long long, int) with two long long partials compiles, but it
+// narrows the second one. Where op's parameter types are fixed, each must be T.
+// op(long long, int)를 두 long long 부분 결과로 호출하면 compile되지만 두 번째가 좁아짐.
+// op의 parameter type이 고정되어 있으면 각각 T여야 함.
+template<typename T, typename Op>
+constexpr bool mergesPartials() {
+    if constexpr (!std::is_invocable_r_v<T, const Op&, T, T>) {
+        return false;
+    } else {
+        using Parameters = typename CallParameters<Op>::type;
+        if constexpr (std::is_void_v<Parameters>) {
+            return true;
+        } else {
+            return allParametersAre<T>(static_cast<Parameters*>(nullptr));
+        }
+    }
+}
+
+template<typename Iterator, typename Stages = NoStage, bool Parallel = false>
+class Pipeline {
+public:
+    using Input = typename std::iterator_traits<Iterator>::reference;
+    using Output = std::decay_t<typename Stages::template Output<Input>>;
+
+    Pipeline(Iterator f, Iterator l, Stages s = Stages(), ThreadPool* p = nullptr)
+        : first(f), last(l), stages(std::move(s)), pool(p) {}
+
+    template<typename Stage>
+    Pipeline<Iterator, StageChain<Stages, Stage>, Parallel> then(Stage stage) const {
+        return {first, last, StageChain<Stages, Stage>{stages, std::move(stage)}, pool};
+    }
+
+    Pipeline<Iterator, Stages, true> parallel(ThreadPool& p) const {
+        return {first, last, stages, &p};
+    }
+
+    // Fold every output into init with op; in parallel, op also merges the partial results
+    // 모든 출력을 op로 init에 접음; 병렬일 때는 op가 부분 결과도 합침
+    template<typename T, typename Op>
+    T reduce(T init, Op op) const {
+        if constexpr (Parallel) {
+            static_assert(mergesPartials<T, Op>(),
+                          "parallel reduce(init, op) needs op(T, T) -> T; pass reduce(init, op, combine) instead");
+            return reduce(std::move(init), op, op);
+        } else {
+            return reduceRange(first, last, std::move(init), op);
+        }
+    }
+
+    // As above, with combine(T, T) merging the partial results in parallel mode
+    // 위와 같으며, 병렬 mode에서는 combine(T, T)이 부분 결과를 합침
+    //
+    // Every chunk starts from init and the first partial seeds the merge, so init
+    // is folded in once per chunk: it must be the identity of combine, and combine
+    // must be associative.
+    // 모든 chunk가 init에서 시작하고 첫 부분 결과가 합치기의 시작값이므로 init은 chunk마다 한
+    // 번 접힘: init은 combine의 항등원이어야 하고 combine은 결합 법칙을 만족해야 함.
+    template<typename T, typename Op, typename Combine>
+    T reduce(T init, Op op, Combine combine) const {
+        if constexpr (Parallel) {
+            static_assert(std::is_invocable_r_v<T, Combine&, T, T>, "combine must be callable as combine(T, T) -> T");
+            std::vector<std::optional<T>> partials = forEachChunk([&](Iterator lo, Iterator hi) {
+                return reduceRange(lo, hi, init, op);
+            });
+            T total = std::move(*partials[0]); // There is always at least one chunk
+            for (std::size_t i = 1; i < partials.size(); ++i) {
+                total = combine(std::move(total), std::move(*partials[i]));
+            }
+            return total;
+        } else {
+            return reduceRange(first, last, std::move(init), op);
+        }
+    }
+
+    // Every output in a vector, in the order of the range
+    // 모든 출력을 범위의 순서대로 vector에 담음
+    std::vector<Output> collect() const {
+        if constexpr (!Parallel) {
+            return collectRange(first, last);
+        } else {
+            std::vector<std::optional<std::vector<Output>>> parts = forEachChunk([this](Iterator lo, Iterator hi) {
+                return collectRange(lo, hi);
+            });
+            std::size_t total = 0;
+            for (const auto& part : parts) {
+                total += part->size();
+            }
+            std::vector<Output> result;
+            result.reserve(total);
+            for (auto& part : parts) {
+                std::move(part->begin(), part->end(), std::back_inserter(result));
+            }
+            return result;
+        }
+    }
+
+private:
+    Iterator first;
+    Iterator last;
+    Stages stages;
+    ThreadPool* pool;
+
+    // The single fused loop
+    // 하나로 합쳐진 loop
+    template<typename T, typename Op>
+    T reduceRange(Iterator lo, Iterator hi, T acc, const Op& op) const {
+        auto push = stages.bind([&acc, &op](auto&& value) {
+            acc = op(std::move(acc), std::forward<decltype(value)>(value));
+        });
+        for (; lo != hi; ++lo) {
+            push(*lo);
+        }
+        return acc;
+    }
+
+    std::vector<Output> collectRange(Iterator lo, Iterator hi) const {
+        std::vector<Output> out;
+        auto push = stages.bind([&out](auto&& value) {
+            out.push_back(std::forward<decltype(value)>(value));
+        });
+        for (; lo != hi; ++lo) {
+            push(*lo);
+        }
+        return out;
+    }
+
+    // Run work(lo, hi) on a few chunks per pool thread; results in chunk order
+    // Pool thread마다 몇 개의 chunk에서 work(lo, hi)를 실행; 결과는 chunk 순서대로
+    //
+    // Each result sits in its own optional, so the result type needs no
+    // default constructor and a bool result does not become a vector<bool>.
+    // 각 결과는 자신의 optional에 담기므로, 결과 type에 default constructor가 필요 없고 bool
+    // 결과가 vector<bool>이 되지 않음.
+    template<typename Work>
+    auto forEachChunk(Work work) const -> std::vector<std::optional<decltype(work(first, last))>> {
+        std::size_t count = static_cast<std::size_t>(std::distance(first, last));
+        std::size_t numChunks = std::max<std::size_t>(1, std::min<std::size_t>(count, pool->size() * 4));
+        std::size_t chunkSize = (count + numChunks - 1) / numChunks;
+        std::vector<std::optional<decltype(work(first, last))>> results(numChunks);
+        pool->parallel_for(0, numChunks, [&](std::size_t chunk) {
+            std::size_t begin = std::min(count, chunk * chunkSize);
+            std::size_t end = std::min(count, begin + chunkSize);
+            results[chunk] = work(std::next(first, begin), std::next(first, end));
+        });
+        return results;
+    }
+};
+
+// Start a pipeline over a container; the container must outlive the pipeline
+// Container에 대한 pipeline을 시작; container는 pipeline보다 오래 살아야 함
+template<typename Range>
+auto from(const Range& range) {
+    using std::begin;
+    using std::end;
+    return Pipeline<decltype(begin(range))>(begin(range), end(range));
+}
+
+template<typename Predicate>
+FilterStage<std::decay_t<Predicate>> filter(Predicate&& predicate) {
+    return {std::forward<Predicate>(predicate)};
+}
+
+template<typename Function>
+MapStage<std::decay_t<Function>> map(Function&& function) {
+    return {std::forward<Function>(function)};
+}
+
+template<typename T, typename Op>
+ReduceTerminal<T, std::decay_t<Op>> reduce(T init, Op&& op) {
+    return {std::move(init), std::forward<Op>(op), CombineWithOp()};
+}
+
+template<typename T, typename Op, typename Combine>
+ReduceTerminal<T, std::decay_t<Op>, std::decay_t<Combine>> reduce(T init, Op&& op, Combine&& combine) {
+    return {std::move(init), std::forward<Op>(op), std::forward<Combine>(combine)};
+}
+
+inline CollectTerminal collect() {
+    return {};
+}
+
+inline ParallelMode parallel(ThreadPool& pool) {
+    return {&pool};
+}
+
+template<typename Iterator, typename Stages, bool Parallel, typename Predicate>
+auto operator|(const Pipeline<Iterator, Stages, Parallel>& pipeline, FilterStage<Predicate> stage) {
+    return pipeline.then(std::move(stage));
+}
+
+template<typename Iterator, typename Stages, bool Parallel, typename Function>
+auto operator|(const Pipeline<Iterator, Stages, Parallel>& pipeline, MapStage<Function> stage) {
+    return pipeline.then(std::move(stage));
+}
+
+template<typename Iterator, typename Stages, bool Parallel>
+Pipeline<Iterator, Stages, true> operator|(const Pipeline<Iterator, Stages, Parallel>& pipeline, ParallelMode mode) {
+    return pipeline.parallel(*mode.pool);
+}
+
+template<typename Iterator, typename Stages, bool Parallel, typename T, typename Op, typename Combine>
+T operator|(const Pipeline<Iterator, Stages, Parallel>& pipeline, const ReduceTerminal<T, Op, Combine>& terminal) {
+    if constexpr (std::is_same_v<Combine, CombineWithOp>) {
+        return pipeline.reduce(terminal.init, terminal.op);
+    } else {
+        return pipeline.reduce(terminal.init, terminal.op, terminal.combine);
+    }
+}
+
+template<typename Iterator, typename Stages, bool Parallel>
+auto operator|(const Pipeline<Iterator, Stages, Parallel>& pipeline, CollectTerminal) {
+    return pipeline.collect();
+}
+
+#endif // EX22_PIPELINE_H
@@ -0,0 +1,29 @@
+#include <cstddef>
+
+#include "benchmark.h"
+
+// The overloads of the example without the output
+// 출력이 없는 예제의 overload
+__attribute__((noinline)) int func(int* ptr) {
+    return ptr ? 1 : 0;
+}
+
+__attribute__((noinline)) int func(char* ptr) {
+    return ptr ? 2 : 0;
+}
+
+int main(int argc, char* argv[]) {
+    auto bench = Benchmark<>::fromArgs(argc, argv);
+
+    // Overload resolution happens at compile time, so nullptr is exactly as
+    // cheap as a cast NULL: it removes the ambiguity, not run-time work
+    // Overload 결정은 compile 시점에 일어나므로 nullptr은 cast한 NULL과 비용이 같음:
+    // nullptr이 없애는 것은 모호성이지 실행 시간 작업이 아님
+    bench.section("Calling func() with a null pointer, ns per call");
+    bench.run("func((int*)NULL)", []() { doNotOptimize(func((int*)NULL)); });
+    bench.run("func((int*)nullptr)", []() { doNotOptimize(func((int*)nullptr)); });
+    bench.run("func(static_cast<int*>(nullptr))", []() { doNotOptimize(func(static_cast<int*>(nullptr))); });
+
+    bench.report();
+    return 0;
+}
@@ -0,0 +1,37 @@
+#ifndef EX51_COUNTER_H
+#define EX51_COUNTER_H
+
+class Counter {
+private:
+    // Single private member variable
+    // 단일 private member 변수
+    int count;
+
+public:
+    // Constructor
+    // Constructor
+    Counter(int initialValue = 0) : count(initialValue) {
+    }
+
+    // Method to increment the value
+    // 값을 증가시키는 method
+    void increment() {
+        count++;
+    }
+
+    // Method to decrement the value
+    // 값을 감소시키는 method
+    void decrement() {
+        if (count > 0) {  // Prevent negative values / 음수 값 방지
+            count--;
+        }
+    }
+
+    // Method to read the current value
+    // 현재 값을 읽는 method
+    int getValue() const {
+        return count;
+    }
+};
+
+#endif // EX51_COUNTER_H
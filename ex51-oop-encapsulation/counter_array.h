@@ -0,0 +1,204 @@
+#ifndef EX51_COUNTER_ARRAY_H
+#define EX51_COUNTER_ARRAY_H
+
+#include <algorithm>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+class CounterView;
+
+// Many counters in one contiguous array, updated in bulk
+// 하나의 연속된 배열에 있는 여러 counter, 한꺼번에 갱신
+//
+// Each count is a plain int, so a rate limiter with millions of token buckets
+// needs no object per client. Updates take either a batch of indices (one
+// client per request, an index listed twice is updated twice) or a range of
+// counters (a periodic refill of every bucket). Decrement keeps the rule of
+// Counter: a count that is not positive is left alone. Increment and refill
+// add up to a ceiling instead of overflowing. The range kernels update 8
+// (AVX2) or 4 (SSE2) counts per instruction and fall back to a scalar loop
+// when neither is enabled at compile time. The batch loops have no vector
+// form, since an index may repeat within a batch, but they do not branch on
+// the count either.
+// 각 count는 단순한 int이므로, 수백만 개의 token bucket을 가진 rate limiter도 client마다
+// 객체가 필요 없음. 갱신은 index batch (요청마다 client 하나, 두 번 나온 index는 두 번
+// 갱신됨) 또는 counter 범위 (모든 bucket의 주기적 refill)를 받음. Decrement는 Counter의
+// 규칙을 유지함: 양수가 아닌 count는 그대로 둠. Increment와 refill은 overflow 대신 상한까지만
+// 더함. 범위 kernel은 instruction마다 8개 (AVX2) 또는 4개 (SSE2)의 count를 갱신하며,
+// compile 시 둘 다 활성화되지 않으면 scalar loop를 사용함. Batch 안에서 index가 반복될 수
+// 있으므로 batch loop에는 vector 형태가 없지만, count에 따라 분기하지도 않음.
+class CounterArray {
+public:
+    CounterArray(std::size_t size, int initialValue = 0) : counts(size, initialValue) {
+    }
+
+    std::size_t size() const {
+        return counts.size();
+    }
+
+    int getValue(std::size_t index) const {
+        return counts[index];
+    }
+
+    void setValue(std::size_t index, int value) {
+        counts[index] = value;
+    }
+
+    // One counter with the Counter interface
+    // Counter interface를 가진 counter 하나
+    CounterView view(std::size_t index);
+
+    // Add 1 to every listed counter, stopping at INT_MAX
+    // 나열된 모든 counter에 1을 더함, INT_MAX에서 멈춤
+    void increment(const std::uint32_t* indices, std::size_t n) {
+        refill(indices, n, 1, INT_MAX);
+    }
+
+    // Subtract 1 from every listed counter that is above zero
+    // 0보다 큰 나열된 모든 counter에서 1을 뺌
+    void decrement(const std::uint32_t* indices, std::size_t n) {
+        for (std::size_t i = 0; i < n; ++i) {
+            int& count = counts[indices[i]];
+            count -= count > 0;
+        }
+    }
+
+    // Add amount to every listed counter, up to capacity; amount and capacity must not be negative
+    // 나열된 모든 counter에 capacity까지 amount를 더함; amount와 capacity는 음수가 아니어야 함
+    //
+    // Computed as min(count, capacity - amount) + amount, which cannot overflow;
+    // a count already above capacity is lowered to it.
+    // min(count, capacity - amount) + amount로 계산하므로 overflow가 나지 않음; 이미
+    // capacity보다 큰 count는 capacity로 낮아짐.
+    void refill(const std::uint32_t* indices, std::size_t n, int amount, int capacity) {
+        const int limit = capacity - amount;
+        for (std::size_t i = 0; i < n; ++i) {
+            int& count = counts[indices[i]];
+            count = std::min(count, limit) + amount;
+        }
+    }
+
+    // The same updates on the counters in [first, last)
+    // [first, last) 범위의 counter에 대한 같은 갱신
+    void incrementRange(std::size_t first, std::size_t last) {
+        refillRange(first, last, 1, INT_MAX);
+    }
+
+    void decrementRange(std::size_t first, std::size_t last) {
+        decrementPositive(counts.data() + first, last - first);
+    }
+
+    void refillRange(std::size_t first, std::size_t last, int amount, int capacity) {
+        addClamped(counts.data() + first, last - first, amount, capacity - amount);
+    }
+
+    // Instruction set the range kernels were compiled for
+    // 범위 kernel이 compile된 instruction set
+    static const char* kernelName() {
+#if defined(__AVX2__)
+        return "AVX2";
+#elif defined(__SSE2__)
+        return "SSE2";
+#else
+        return "scalar";
+#endif
+    }
+
+private:
+    std::vector<int> counts;
+
+    // x[i] = min(x[i], limit) + amount
+    static void addClamped(int* x, std::size_t n, int amount, int limit) {
+        std::size_t i = 0;
+#if defined(__AVX2__)
+        const __m256i l = _mm256_set1_epi32(limit);
+        const __m256i a = _mm256_set1_epi32(amount);
+        for (; i + 8 <= n; i += 8) {
+            __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(x + i));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(x + i), _mm256_add_epi32(_mm256_min_epi32(v, l), a));
+        }
+#elif defined(__SSE2__)
+        // SSE2 has no 32-bit min; select with a compare mask instead
+        // SSE2에는 32-bit min이 없으므로 비교 mask로 선택함
+        const __m128i l = _mm_set1_epi32(limit);
+        const __m128i a = _mm_set1_epi32(amount);
+        for (; i + 4 <= n; i += 4) {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(x + i));
+            __m128i above = _mm_cmpgt_epi32(v, l);
+            __m128i clamped = _mm_or_si128(_mm_and_si128(above, l), _mm_andnot_si128(above, v));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(x + i), _mm_add_epi32(clamped, a));
+        }
+#endif
+        for (; i < n; ++i) {
+            x[i] = std::min(x[i], limit) + amount;
+        }
+    }
+
+    // x[i] -= 1 where x[i] > 0; the compare mask is -1 exactly there, so it is added
+    // x[i] > 0인 곳에서 x[i] -= 1; 비교 mask가 정확히 그곳에서 -1이므로 mask를 더함
+    static void decrementPositive(int* x, std::size_t n) {
+        std::size_t i = 0;
+#if defined(__AVX2__)
+        const __m256i zero = _mm256_setzero_si256();
+        for (; i + 8 <= n; i += 8) {
+            __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(x + i));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(x + i), _mm256_add_epi32(v, _mm256_cmpgt_epi32(v, zero)));
+        }
+#elif defined(__SSE2__)
+        const __m128i zero = _mm_setzero_si128();
+        for (; i + 4 <= n; i += 4) {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(x + i));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(x + i), _mm_add_epi32(v, _mm_cmpgt_epi32(v, zero)));
+        }
+#endif
+        for (; i < n; ++i) {
+            x[i] -= x[i] > 0;
+        }
+    }
+};
+
+// One element of a CounterArray with the methods of Counter
+// Counter의 method를 가진 CounterArray의 요소 하나
+//
+// The view refers to the element and does not copy it, so it must not
+// outlive the array. Like the bulk updates, increment() stops at INT_MAX.
+// View는 요소를 복사하지 않고 참조하므로 배열보다 오래 살아서는 안 됨. 일괄 갱신처럼
+// increment()는 INT_MAX에서 멈춤.
+class CounterView {
+private:
+    int* count;
+
+public:
+    explicit CounterView(int& c) : count(&c) {
+    }
+
+    void increment() {
+        if (*count < INT_MAX) {
+            (*count)++;
+        }
+    }
+
+    void decrement() {
+        if (*count > 0) {  // Prevent negative values / 음수 값 방지
+            (*count)--;
+        }
+    }
+
+    int getValue() const {
+        return *count;
+    }
+};
+
+inline CounterView CounterArray::view(std::size_t index) {
+    return CounterView(counts[index]);
+}
+
+#endif // EX51_COUNTER_ARRAY_H
@@ -1,37 +1,8 @@
+#include <cstdint>
 #include <iostream>
 
-class Counter {
-private:
-    // Single private member variable
-    // 단일 private member 변수
-    int count;
-    
-public:
-    // Constructor
-    // Constructor
-    Counter(int initialValue = 0) : count(initialValue) {
-    }
-
-    // Method to increment the value
-    // 값을 증가시키는 method
-    void increment() {
-        count++;
-    }
-
-    // Method to decrement the value
-    // 값을 감소시키는 method
-    void decrement() {
-        if (count > 0) {  // Prevent negative values / 음수 값 방지
-            count--;
-        }
-    }
-
-    // Method to read the current value
-    // 현재 값을 읽는 method
-    int getValue() const {
-        return count;
-    }
-};
+#include "counter.h"
+#include "counter_array.h"
 
 int main() {
     // Create a counter object with initial value of 5
@@ -50,5 +21,34 @@ int main() {
     counter.decrement();
     std::cout << "After decrement: " << counter.getValue() << "\n";
 
+    // Eight token buckets of capacity 3, all starting full
+    // Capacity가 3이고 모두 가득 찬 상태로 시작하는 token bucket 8개
+    CounterArray buckets(8, 3);
+
+    // A batch of requests; client 2 asks four times and runs out
+    // 요청 batch; client 2는 네 번 요청하여 token이 바닥남
+    const std::uint32_t requests[] = {2, 5, 2, 2, 2, 7};
+    buckets.decrement(requests, sizeof(requests) / sizeof(requests[0]));
+    std::cout << "\nAfter requests:";
+    for (std::size_t i = 0; i < buckets.size(); ++i) {
+        std::cout << " " << buckets.getValue(i);
+    }
+    std::cout << "\n";
+
+    // Refill every bucket by 2 tokens, never above its capacity
+    // 모든 bucket에 token 2개를 refill, capacity를 넘지 않음
+    buckets.refillRange(0, buckets.size(), 2, 3);
+    std::cout << "After refill (" << CounterArray::kernelName() << "):";
+    for (std::size_t i = 0; i < buckets.size(); ++i) {
+        std::cout << " " << buckets.getValue(i);
+    }
+    std::cout << "\n";
+
+    // A view updates one bucket through the methods of Counter
+    // View는 Counter의 method로 bucket 하나를 갱신
+    CounterView bucket = buckets.view(2);
+    bucket.decrement();
+    std::cout << "Bucket 2 after one more request: " << bucket.getValue() << "\n";
+
     return 0;
 }
\ No newline at end of file
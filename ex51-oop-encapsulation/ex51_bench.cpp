@@ -0,0 +1,158 @@
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "benchmark.h"
+#include "counter.h"
+#include "counter_array.h"
+
+// Counter updates in one batch of random indices
+// 무작위 index batch 하나의 counter 갱신 수
+constexpr int kBatch = 1 << 20;
+
+// Tokens in a full bucket; far more than the benchmark ever takes out
+// 가득 찬 bucket의 token 수; 벤치마크가 꺼내는 양보다 훨씬 많음
+constexpr int kFull = 1 << 30;
+
+// Counter objects against a CounterArray of the same size, over every counter and over random batches
+// 같은 크기의 Counter 객체와 CounterArray 비교, 모든 counter와 무작위 batch에 대해
+bool benchCounters(Benchmark<>& bench, std::size_t n) {
+    std::mt19937 rng(42);
+    std::vector<Counter> counters(n);
+    CounterArray array(n);
+    std::vector<std::uint32_t> indices(kBatch);
+    for (std::uint32_t& index : indices) {
+        index = static_cast<std::uint32_t>(rng() % n);
+    }
+
+    // The bulk updates must agree with the Counter methods on small counts, where decrement stops at zero
+    // 감소가 0에서 멈추는 작은 count에서 일괄 갱신은 Counter method와 일치해야 함
+    for (std::size_t i = 0; i < n; ++i) {
+        int value = static_cast<int>(rng() % 4);
+        counters[i] = Counter(value);
+        array.setValue(i, value);
+    }
+    for (std::uint32_t index : indices) {
+        counters[index].decrement();
+    }
+    for (std::uint32_t index : indices) {
+        counters[index].increment();
+    }
+    array.decrement(indices.data(), indices.size());
+    array.increment(indices.data(), indices.size());
+    for (std::size_t i = 0; i < n; ++i) {
+        counters[i].decrement();
+    }
+    array.decrementRange(0, n);
+    for (std::size_t i = 0; i < n; ++i) {
+        if (counters[i].getValue() != array.getValue(i)) {
+            std::cerr << "Counter mismatch at index " << i << std::endl;
+            return false;
+        }
+    }
+
+    // Half of the buckets empty and half nearly full, at random: decrement leaves
+    // both kinds as they are, so the branch in Counter::decrement() stays
+    // unpredictable however many times the rows run
+    // 무작위로 bucket의 절반은 비어 있고 절반은 거의 가득 참: decrement는 두 종류를 그대로
+    // 두므로, row를 몇 번 실행하든 Counter::decrement()의 분기는 예측하기 어려움
+    auto reset = [&]() {
+        for (std::size_t i = 0; i < n; ++i) {
+            int value = rng() % 2 == 0 ? 0 : kFull;
+            counters[i] = Counter(value);
+            array.setValue(i, value);
+        }
+    };
+
+    BenchmarkOptions options = bench.defaults();
+    options.samples = std::min(options.samples, 10);
+
+    reset();
+    bench.section(std::to_string(n) + " counters, every counter (" + CounterArray::kernelName() + " kernels), ns per update");
+    auto decrementRow = bench.run("Counter::decrement() each", options, [&counters]() {
+        for (Counter& c : counters) {
+            c.decrement();
+        }
+        clobberMemory();
+    }, n);
+    auto decrementRangeRow = bench.run("decrementRange()", options, [&array, n]() {
+        array.decrementRange(0, n);
+        clobberMemory();
+    }, n);
+    auto incrementRow = bench.run("Counter::increment() each", options, [&counters]() {
+        for (Counter& c : counters) {
+            c.increment();
+        }
+        clobberMemory();
+    }, n);
+    auto incrementRangeRow = bench.run("incrementRange()", options, [&array, n]() {
+        array.incrementRange(0, n);
+        clobberMemory();
+    }, n);
+    auto refillRangeRow = bench.run("refillRange()", options, [&array, n]() {
+        array.refillRange(0, n, 1, kFull);
+        clobberMemory();
+    }, n);
+    bench.noteSpeedup(decrementRow, decrementRangeRow);
+    bench.noteSpeedup(incrementRow, incrementRangeRow);
+    bench.noteRate(decrementRangeRow, "updates");
+    bench.noteRate(incrementRangeRow, "updates");
+    bench.noteRate(refillRangeRow, "updates");
+
+    // One update per request, to a random client
+    // 요청마다 무작위 client 하나에 갱신 한 번
+    reset();
+    bench.section(std::to_string(n) + " counters, batch of " + std::to_string(kBatch) + " random indices, ns per update");
+    auto indexedRow = bench.run("Counter::decrement() by index", options, [&counters, &indices]() {
+        for (std::uint32_t index : indices) {
+            counters[index].decrement();
+        }
+        clobberMemory();
+    }, kBatch);
+    auto batchRow = bench.run("decrement(indices)", options, [&array, &indices]() {
+        array.decrement(indices.data(), indices.size());
+        clobberMemory();
+    }, kBatch);
+    auto refillBatchRow = bench.run("refill(indices)", options, [&array, &indices]() {
+        array.refill(indices.data(), indices.size(), 1, kFull);
+        clobberMemory();
+    }, kBatch);
+    bench.noteSpeedup(indexedRow, batchRow);
+    bench.noteRate(batchRow, "updates");
+    bench.noteRate(refillBatchRow, "updates");
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    auto bench = Benchmark<>::fromArgs(argc, argv);
+
+    // Encapsulation is free: the methods inline to plain integer operations
+    // Encapsulation은 비용이 없음: method는 단순한 정수 연산으로 inline됨
+    bench.section("One Counter, ns per call");
+    Counter counter(5);
+    bench.run("increment()", [&counter]() {
+        counter.increment();
+        doNotOptimize(counter);
+    });
+    bench.run("decrement()", [&counter]() {
+        counter.decrement();
+        doNotOptimize(counter);
+    });
+    bench.run("getValue()", [&counter]() {
+        doNotOptimize(counter.getValue());
+    });
+
+    // 1M counters take 4 MB per copy and stay in cache; 100M take 400 MB and run from memory
+    // 1M개의 counter는 사본당 4 MB로 cache에 머물고, 100M개는 400 MB로 memory에서 동작함
+    for (std::size_t n : {std::size_t(1) << 20, std::size_t(100000000)}) {
+        if (!benchCounters(bench, n)) {
+            return 1;
+        }
+    }
+
+    bench.report();
+    return 0;
+}
@@ -2,6 +2,8 @@
 #include <string>
 #include <memory>
 
+#include "poly_vector.h"
+
 class Animal {
 public:
     // Virtual destructor
@@ -46,5 +48,26 @@ int main() {
     dog->makeSound();  // Output: Woof!
     cat->makeSound();  // Output: Meow!
 
+    // Many animals stored by value, grouped by type
+    // 값으로 저장되고 type별로 묶인 여러 animal
+    PolyVector<Animal> zoo;
+    zoo.emplace<Dog>();
+    zoo.emplace<Cat>();
+    zoo.emplace<Dog>();
+    std::cout << zoo.size() << " animals, dogs first:\n";
+    zoo.forEach([](Animal& animal) {
+        animal.makeSound();  // Output: Woof! Woof! Meow!
+    });
+
+    // A closed set of types in insertion order
+    // 삽입 순서를 유지하는 닫힌 type 집합
+    VariantVector<Dog, Cat> pets;
+    pets.emplace<Cat>();
+    pets.emplace<Dog>();
+    std::cout << pets.size() << " pets in order:\n";
+    pets.forEach([](auto& pet) {
+        pet.makeSound();  // Output: Meow! Woof!
+    });
+
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,172 @@
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "benchmark.h"
+#include "poly_vector.h"
+
+// The Animal hierarchy of the example; makeSound() counts instead of printing
+// 예제의 Animal 계층; makeSound()는 출력 대신 개수를 셈
+struct Sounds {
+    long woofs = 0;
+    long meows = 0;
+};
+
+class Animal {
+public:
+    virtual ~Animal() = default;
+    virtual void makeSound(Sounds& sounds) = 0;
+};
+
+class Dog : public Animal {
+public:
+    void makeSound(Sounds& sounds) override {
+        ++sounds.woofs;
+    }
+};
+
+class Cat : public Animal {
+public:
+    void makeSound(Sounds& sounds) override {
+        ++sounds.meows;
+    }
+};
+
+// Animals called per iteration
+// Iteration마다 호출하는 animal 수
+constexpr int kAnimals = 10000000;
+
+int main(int argc, char* argv[]) {
+    auto bench = Benchmark<>::fromArgs(argc, argv);
+
+    // A random mix, so the branch predictor cannot guess the next type
+    // 무작위로 섞어 branch predictor가 다음 type을 추측할 수 없게 함
+    std::vector<bool> isDog(kAnimals);
+    std::mt19937 rng(42);
+    for (int i = 0; i < kAnimals; ++i) {
+        isDog[i] = rng() % 2 == 0;
+    }
+
+    std::vector<std::unique_ptr<Animal>> animals;
+    std::vector<std::unique_ptr<Animal>> sorted;
+    PolyVector<Animal> poly;
+    VariantVector<Dog, Cat> variants;
+    auto buildPointers = [&isDog](std::vector<std::unique_ptr<Animal>>& out) {
+        out.clear();
+        out.reserve(kAnimals);
+        for (int i = 0; i < kAnimals; ++i) {
+            if (isDog[i]) {
+                out.push_back(std::make_unique<Dog>());
+            } else {
+                out.push_back(std::make_unique<Cat>());
+            }
+        }
+    };
+    auto buildPoly = [&isDog](PolyVector<Animal>& out) {
+        out.clear();
+        for (int i = 0; i < kAnimals; ++i) {
+            if (isDog[i]) {
+                out.emplace<Dog>();
+            } else {
+                out.emplace<Cat>();
+            }
+        }
+    };
+    auto buildVariants = [&isDog](VariantVector<Dog, Cat>& out) {
+        out.clear();
+        out.reserve(kAnimals);
+        for (int i = 0; i < kAnimals; ++i) {
+            if (isDog[i]) {
+                out.emplace<Dog>();
+            } else {
+                out.emplace<Cat>();
+            }
+        }
+    };
+    buildPointers(animals);
+    buildPoly(poly);
+    buildVariants(variants);
+    sorted.reserve(kAnimals);
+    for (int i = 0; i < kAnimals; ++i) {
+        if (i < kAnimals / 2) {
+            sorted.push_back(std::make_unique<Dog>());
+        } else {
+            sorted.push_back(std::make_unique<Cat>());
+        }
+    }
+
+    // Every container must hold the same animals
+    // 모든 container는 같은 animal을 담아야 함
+    Sounds expected;
+    for (auto& animal : animals) {
+        animal->makeSound(expected);
+    }
+    Sounds fromPoly;
+    poly.forEach([&fromPoly](Animal& animal) { animal.makeSound(fromPoly); });
+    Sounds fromVariants;
+    variants.forEach([&fromVariants](auto& animal) { animal.makeSound(fromVariants); });
+    if (fromPoly.woofs != expected.woofs || fromPoly.meows != expected.meows ||
+        fromVariants.woofs != expected.woofs || fromVariants.meows != expected.meows) {
+        std::cerr << "Containers disagree on the number of dogs and cats" << std::endl;
+        return 1;
+    }
+
+    BenchmarkOptions options = bench.defaults();
+    options.samples = std::min(options.samples, 10);
+
+    bench.section(std::to_string(kAnimals) + " animals, ns per makeSound()");
+    Sounds sounds;
+    auto mixedRow = bench.run("unique_ptr, mixed types", options, [&]() {
+        for (auto& animal : animals) {
+            animal->makeSound(sounds);
+        }
+        doNotOptimize(sounds);
+    }, kAnimals);
+    auto sortedRow = bench.run("unique_ptr, grouped by type", options, [&]() {
+        for (auto& animal : sorted) {
+            animal->makeSound(sounds);
+        }
+        doNotOptimize(sounds);
+    }, kAnimals);
+    auto polyRow = bench.run("PolyVector forEach", options, [&]() {
+        poly.forEach([&sounds](Animal& animal) { animal.makeSound(sounds); });
+        doNotOptimize(sounds);
+    }, kAnimals);
+    auto typedRow = bench.run("PolyVector forEachOf", options, [&]() {
+        poly.forEachOf<Dog>([&sounds](Dog& dog) { dog.makeSound(sounds); });
+        poly.forEachOf<Cat>([&sounds](Cat& cat) { cat.makeSound(sounds); });
+        doNotOptimize(sounds);
+    }, kAnimals);
+    auto variantRow = bench.run("VariantVector, mixed types", options, [&]() {
+        variants.forEach([&sounds](auto& animal) { animal.makeSound(sounds); });
+        doNotOptimize(sounds);
+    }, kAnimals);
+    bench.noteSpeedup(mixedRow, sortedRow);
+    bench.noteSpeedup(mixedRow, polyRow);
+    bench.noteSpeedup(mixedRow, typedRow);
+    bench.noteSpeedup(mixedRow, variantRow);
+
+    // Building the container: one heap allocation per animal, or a few large ones
+    // Container 생성: animal마다 heap 할당 한 번, 또는 큰 할당 몇 번
+    options.samples = std::min(options.samples, 5);
+    bench.section(std::to_string(kAnimals) + " animals, ns per animal to build");
+    auto buildRow = bench.run("unique_ptr", options, [&]() {
+        buildPointers(animals);
+        clobberMemory();
+    }, kAnimals);
+    auto buildPolyRow = bench.run("PolyVector", options, [&]() {
+        buildPoly(poly);
+        clobberMemory();
+    }, kAnimals);
+    auto buildVariantRow = bench.run("VariantVector", options, [&]() {
+        buildVariants(variants);
+        clobberMemory();
+    }, kAnimals);
+    bench.noteSpeedup(buildRow, buildPolyRow);
+    bench.noteSpeedup(buildRow, buildVariantRow);
+
+    bench.report();
+    return 0;
+}
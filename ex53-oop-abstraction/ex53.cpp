@@ -1,84 +1,8 @@
 #include <iostream>
+#include <vector>
 
-// Abstract base class for shapes
-// 도형을 위한 abstract base class
-class Shape {
-private:
-    std::string color;
-
-public:
-    // Constructor with color parameter
-    // 색상 parameter를 가진 constructor
-    Shape(const std::string& c) : color(c) {}
-
-    // Pure virtual function for calculating area
-    // 면적 계산을 위한 pure virtual function
-    virtual double getArea() const = 0;
-
-    // Virtual function to display shape information
-    // 도형 정보를 표시하는 virtual function
-    virtual void printInfo() const {
-        std::cout << "Color: " << color << "\n"
-                  << "Area: " << getArea() << "\n";
-    }
-
-    // Virtual destructor
-    // Virtual destructor
-    virtual ~Shape() = default;
-};
-
-// Circle class derived from Shape
-// Shape로부터 derived된 Circle class
-class Circle : public Shape {
-private:
-    double radius;
-
-public:
-    // Constructor with color and radius
-    // 색상과 반지름을 가진 constructor
-    Circle(const std::string& c, double r)
-        : Shape(c), radius(r) {}
-
-    // Override area calculation for circle
-    // Circle의 면적 계산을 override
-    double getArea() const override {
-        return 3.14 * radius * radius;
-    }
-
-    // Override info display for circle
-    // Circle의 정보 표시를 override
-    void printInfo() const override {
-        std::cout << "Circle Info:\n";
-        Shape::printInfo();
-    }
-};
-
-// Rectangle class derived from Shape
-// Shape로부터 derived된 Rectangle class
-class Rectangle : public Shape {
-private:
-    double width;
-    double height;
-
-public:
-    // Constructor with color, width and height
-    // 색상, 너비, 높이를 가진 constructor
-    Rectangle(const std::string& c, double w, double h)
-        : Shape(c), width(w), height(h) {}
-
-    // Override area calculation for rectangle
-    // Rectangle의 면적 계산을 override
-    double getArea() const override {
-        return width * height;
-    }
-
-    // Override info display for rectangle
-    // Rectangle의 정보 표시를 override
-    void printInfo() const override {
-        std::cout << "Rectangle Info:\n";
-        Shape::printInfo();
-    }
-};
+#include "shape.h"
+#include "shape_store.h"
 
 int main() {
     // Create instances of shapes
@@ -92,5 +16,29 @@ int main() {
     std::cout << "\n";
     rectangle.printInfo();
 
+    // The same shapes kept as columns in a ShapeStore
+    // 같은 도형을 ShapeStore의 column으로 보관
+    ShapeStore store;
+    ShapeStore::Handle storedCircle = store.addCircle("Red", 5);
+    store.addRectangle("Blue", 4, 6);
+    store.addCircle("Green", 1);
+
+    // A view works wherever a Shape is expected
+    // View는 Shape가 필요한 곳 어디서나 동작
+    std::cout << "\n";
+    ShapeView view = store.view(storedCircle);
+    const Shape& shape = view;
+    shape.printInfo();
+
+    // Whole columns at once with the SIMD kernels
+    // SIMD kernel로 column 전체를 한 번에 처리
+    std::vector<double> circleAreas(store.circleCount());
+    store.circleAreas(circleAreas.data());
+    std::cout << "\nCircle areas (" << ShapeStore::kernelName() << "):";
+    for (double area : circleAreas) {
+        std::cout << " " << area;
+    }
+    std::cout << "\nTotal area of " << store.size() << " shapes: " << store.totalArea() << "\n";
+
     return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,152 @@
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "benchmark.h"
+#include "poly_vector.h"
+#include "shape.h"
+#include "shape_store.h"
+
+// Shapes summed per iteration
+// Iteration마다 합산하는 도형 수
+constexpr int kShapes = 10000000;
+
+int main(int argc, char* argv[]) {
+    auto bench = Benchmark<>::fromArgs(argc, argv);
+
+    // The same random shapes as objects, by value in both containers, and as store columns
+    // 같은 무작위 도형을 객체, 두 container의 값, store column으로 생성
+    std::vector<std::unique_ptr<Shape>> shapes;
+    PolyVector<Shape> poly;
+    VariantVector<Circle, Rectangle> variants;
+    std::vector<ShapeStore::Handle> handles;
+    ShapeStore store;
+    variants.reserve(kShapes);
+    shapes.reserve(kShapes);
+    handles.reserve(kShapes);
+    store.reserve(kShapes / 2 + kShapes / 100, kShapes / 2 + kShapes / 100);
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<double> size(1.0, 10.0);
+    for (int i = 0; i < kShapes; ++i) {
+        if (rng() % 2 == 0) {
+            double r = size(rng);
+            shapes.push_back(std::make_unique<Circle>("Red", r));
+            poly.emplace<Circle>("Red", r);
+            variants.emplace<Circle>("Red", r);
+            handles.push_back(store.addCircle("Red", r));
+        } else {
+            double w = size(rng);
+            double h = size(rng);
+            shapes.push_back(std::make_unique<Rectangle>("Blue", w, h));
+            poly.emplace<Rectangle>("Blue", w, h);
+            variants.emplace<Rectangle>("Blue", w, h);
+            handles.push_back(store.addRectangle("Blue", w, h));
+        }
+    }
+
+    // The kernels must give the same per-shape areas as getArea(), and the same total up to rounding
+    // Kernel은 getArea()와 같은 도형별 면적을, 그리고 반올림 오차 범위에서 같은 합계를 내야 함
+    std::vector<double> circleAreas(store.circleCount());
+    std::vector<double> rectangleAreas(store.rectangleCount());
+    store.circleAreas(circleAreas.data());
+    store.rectangleAreas(rectangleAreas.data());
+    double virtualTotal = 0.0;
+    for (std::size_t i = 0; i < shapes.size(); ++i) {
+        const auto& areas = handles[i].kind == ShapeStore::Kind::Circle ? circleAreas : rectangleAreas;
+        if (areas[handles[i].index] != shapes[i]->getArea()) {
+            std::cerr << "Area mismatch at shape " << i << std::endl;
+            return 1;
+        }
+        virtualTotal += shapes[i]->getArea();
+    }
+    double polyTotal = 0.0;
+    poly.forEach([&polyTotal](const Shape& shape) { polyTotal += shape.getArea(); });
+    double variantTotal = 0.0;
+    variants.forEach([&variantTotal](const auto& shape) { variantTotal += shape.getArea(); });
+    for (double total : {store.totalArea(), polyTotal, variantTotal}) {
+        if (std::abs(total - virtualTotal) > 1e-9 * virtualTotal) {
+            std::cerr << "Total area mismatch: " << total << " vs " << virtualTotal << std::endl;
+            return 1;
+        }
+    }
+
+    BenchmarkOptions options = bench.defaults();
+    options.samples = std::min(options.samples, 10);
+
+    // Total area through the abstract interface: one indirect call per shape
+    // Abstract interface를 통한 전체 면적: 도형마다 간접 호출 한 번
+    bench.section(std::to_string(kShapes) + " shapes, ns per shape (" + ShapeStore::kernelName() + " kernels)");
+    auto virtualRow = bench.run("virtual getArea(), total area", options, [&shapes]() {
+        double total = 0.0;
+        for (const auto& shape : shapes) {
+            total += shape->getArea();
+        }
+        doNotOptimize(total);
+    }, kShapes);
+
+    // The objects by value, one type after another or in a variant
+    // 값으로 저장한 객체, type별로 차례로 또는 variant로
+    auto polyRow = bench.run("PolyVector forEach", options, [&poly]() {
+        double total = 0.0;
+        poly.forEach([&total](const Shape& shape) { total += shape.getArea(); });
+        doNotOptimize(total);
+    }, kShapes);
+    auto typedRow = bench.run("PolyVector forEachOf", options, [&poly]() {
+        double total = 0.0;
+        poly.forEachOf<Circle>([&total](const Circle& circle) { total += circle.getArea(); });
+        poly.forEachOf<Rectangle>([&total](const Rectangle& rectangle) { total += rectangle.getArea(); });
+        doNotOptimize(total);
+    }, kShapes);
+    auto variantRow = bench.run("VariantVector, mixed types", options, [&variants]() {
+        double total = 0.0;
+        variants.forEach([&total](const auto& shape) { total += shape.getArea(); });
+        doNotOptimize(total);
+    }, kShapes);
+
+    // Same columns one shape at a time, in the original mixed order
+    // 같은 column을 원래의 섞인 순서로 도형 하나씩
+    auto mixedRow = bench.run("ShapeStore::area(), mixed order", options, [&store, &handles]() {
+        double total = 0.0;
+        for (const auto& handle : handles) {
+            total += store.area(handle);
+        }
+        doNotOptimize(total);
+    }, kShapes);
+
+    // One kind after the other: a scalar walk down each column
+    // 종류별로 차례대로: 각 column을 scalar로 순회
+    auto columnRow = bench.run("ShapeStore::area(), by column", options, [&store]() {
+        double total = 0.0;
+        for (std::uint32_t i = 0; i < store.circleCount(); ++i) {
+            total += store.area(ShapeStore::Handle{ShapeStore::Kind::Circle, i});
+        }
+        for (std::uint32_t i = 0; i < store.rectangleCount(); ++i) {
+            total += store.area(ShapeStore::Handle{ShapeStore::Kind::Rectangle, i});
+        }
+        doNotOptimize(total);
+    }, kShapes);
+
+    auto totalRow = bench.run("ShapeStore::totalArea()", options, [&store]() {
+        doNotOptimize(store.totalArea());
+    }, kShapes);
+
+    auto areasRow = bench.run("ShapeStore area columns", options, [&]() {
+        store.circleAreas(circleAreas.data());
+        store.rectangleAreas(rectangleAreas.data());
+        clobberMemory();
+    }, kShapes);
+
+    bench.noteSpeedup(virtualRow, polyRow);
+    bench.noteSpeedup(virtualRow, typedRow);
+    bench.noteSpeedup(virtualRow, variantRow);
+    bench.noteSpeedup(virtualRow, mixedRow);
+    bench.noteSpeedup(virtualRow, columnRow);
+    bench.noteSpeedup(virtualRow, totalRow);
+    bench.noteSpeedup(virtualRow, areasRow);
+
+    bench.report();
+    return 0;
+}
@@ -0,0 +1,260 @@
+#ifndef EX53_SHAPE_STORE_H
+#define EX53_SHAPE_STORE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "shape.h"
+
+class ShapeView;
+
+// Many shapes stored as one column per field (struct-of-arrays)
+// 필드마다 column 하나로 저장된 여러 도형 (struct-of-arrays)
+//
+// Each kind keeps its fields in contiguous vectors (radius for circles, width
+// and height for rectangles) plus a small color id into a shared palette, so
+// computing areas walks plain arrays of doubles instead of chasing a pointer
+// and making an indirect call per shape. The area kernels process 4 (AVX2)
+// or 2 (SSE2) doubles per instruction and fall back to a scalar loop when
+// neither is enabled at compile time. view() still gives one element as a
+// Shape for code written against the abstract interface.
+// 각 종류는 필드를 연속된 vector (circle은 radius, rectangle은 width와 height)와 공유
+// palette의 작은 색상 id로 보관하므로, 면적 계산은 도형마다 pointer를 따라가며 간접
+// 호출하는 대신 double 배열을 순회함. 면적 kernel은 instruction마다 4개 (AVX2) 또는
+// 2개 (SSE2)의 double을 처리하며, compile 시 둘 다 활성화되지 않으면 scalar loop를
+// 사용함. view()는 abstract interface로 작성된 code를 위해 한 요소를 Shape로 제공함.
+class ShapeStore {
+public:
+    enum class Kind : std::uint8_t { Circle, Rectangle };
+
+    // Identifies one shape: its kind and its row in that kind's columns
+    // 도형 하나를 식별: 종류와 그 종류의 column에서의 행
+    struct Handle {
+        Kind kind;
+        std::uint32_t index;
+    };
+
+    Handle addCircle(const std::string& color, double r) {
+        radius.push_back(r);
+        circleColor.push_back(colorId(color));
+        return Handle{Kind::Circle, static_cast<std::uint32_t>(radius.size() - 1)};
+    }
+
+    Handle addRectangle(const std::string& color, double w, double h) {
+        width.push_back(w);
+        height.push_back(h);
+        rectangleColor.push_back(colorId(color));
+        return Handle{Kind::Rectangle, static_cast<std::uint32_t>(width.size() - 1)};
+    }
+
+    void reserve(std::size_t circles, std::size_t rectangles) {
+        radius.reserve(circles);
+        circleColor.reserve(circles);
+        width.reserve(rectangles);
+        height.reserve(rectangles);
+        rectangleColor.reserve(rectangles);
+    }
+
+    std::size_t circleCount() const {
+        return radius.size();
+    }
+
+    std::size_t rectangleCount() const {
+        return width.size();
+    }
+
+    std::size_t size() const {
+        return circleCount() + rectangleCount();
+    }
+
+    // Same formulas as Circle::getArea() and Rectangle::getArea()
+    // Circle::getArea(), Rectangle::getArea()와 같은 식
+    double area(Handle shape) const {
+        if (shape.kind == Kind::Circle) {
+            return 3.14 * radius[shape.index] * radius[shape.index];
+        }
+        return width[shape.index] * height[shape.index];
+    }
+
+    const std::string& color(Handle shape) const {
+        return palette[shape.kind == Kind::Circle ? circleColor[shape.index] : rectangleColor[shape.index]];
+    }
+
+    // Area of every circle / rectangle, in insertion order; out must hold circleCount() / rectangleCount()
+    // 모든 circle / rectangle의 면적 (추가한 순서); out은 circleCount() / rectangleCount()개를 담아야 함
+    //
+    // Each element is computed exactly as getArea() does, so the results are identical.
+    // 각 요소는 getArea()와 똑같이 계산되므로 결과가 동일함.
+    void circleAreas(double* out) const {
+        scaledSquares(radius.data(), 3.14, out, radius.size());
+    }
+
+    void rectangleAreas(double* out) const {
+        products(width.data(), height.data(), out, width.size());
+    }
+
+    // Sum of all areas; summed in a different order than a loop over getArea(),
+    // so the last few bits may differ
+    // 모든 면적의 합; getArea() loop와 다른 순서로 합산하므로 마지막 몇 bit가 다를 수 있음
+    double totalArea() const {
+        return 3.14 * sumOfSquares(radius.data(), radius.size()) +
+               sumOfProducts(width.data(), height.data(), width.size());
+    }
+
+    // One shape through the Shape interface
+    // Shape interface를 통한 도형 하나
+    ShapeView view(Handle shape) const;
+
+    // Instruction set the kernels were compiled for
+    // Kernel이 compile된 instruction set
+    static const char* kernelName() {
+#if defined(__AVX2__)
+        return "AVX2";
+#elif defined(__SSE2__)
+        return "SSE2";
+#else
+        return "scalar";
+#endif
+    }
+
+private:
+    std::vector<double> radius;
+    std::vector<std::uint16_t> circleColor;
+    std::vector<double> width;
+    std::vector<double> height;
+    std::vector<std::uint16_t> rectangleColor;
+    std::vector<std::string> palette; // A handful of colors, searched linearly
+                                      // 몇 개의 색상, 선형 탐색
+
+    std::uint16_t colorId(const std::string& name) {
+        for (std::size_t i = 0; i < palette.size(); ++i) {
+            if (palette[i] == name) {
+                return static_cast<std::uint16_t>(i);
+            }
+        }
+        palette.push_back(name);
+        return static_cast<std::uint16_t>(palette.size() - 1);
+    }
+
+    // out[i] = scale * x[i] * x[i]
+    static void scaledSquares(const double* x, double scale, double* out, std::size_t n) {
+        std::size_t i = 0;
+#if defined(__AVX2__)
+        const __m256d s = _mm256_set1_pd(scale);
+        for (; i + 4 <= n; i += 4) {
+            __m256d v = _mm256_loadu_pd(x + i);
+            _mm256_storeu_pd(out + i, _mm256_mul_pd(_mm256_mul_pd(s, v), v));
+        }
+#elif defined(__SSE2__)
+        const __m128d s = _mm_set1_pd(scale);
+        for (; i + 2 <= n; i += 2) {
+            __m128d v = _mm_loadu_pd(x + i);
+            _mm_storeu_pd(out + i, _mm_mul_pd(_mm_mul_pd(s, v), v));
+        }
+#endif
+        for (; i < n; ++i) {
+            out[i] = scale * x[i] * x[i];
+        }
+    }
+
+    // out[i] = a[i] * b[i]
+    static void products(const double* a, const double* b, double* out, std::size_t n) {
+        std::size_t i = 0;
+#if defined(__AVX2__)
+        for (; i + 4 <= n; i += 4) {
+            _mm256_storeu_pd(out + i, _mm256_mul_pd(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i)));
+        }
+#elif defined(__SSE2__)
+        for (; i + 2 <= n; i += 2) {
+            _mm_storeu_pd(out + i, _mm_mul_pd(_mm_loadu_pd(a + i), _mm_loadu_pd(b + i)));
+        }
+#endif
+        for (; i < n; ++i) {
+            out[i] = a[i] * b[i];
+        }
+    }
+
+    static double sumOfSquares(const double* x, std::size_t n) {
+        return sumOfProducts(x, x, n);
+    }
+
+    // Sum of a[i] * b[i]; two vector accumulators hide the add latency
+    // a[i] * b[i]의 합; vector accumulator 두 개로 덧셈 latency를 감춤
+    static double sumOfProducts(const double* a, const double* b, std::size_t n) {
+        std::size_t i = 0;
+        double total = 0.0;
+#if defined(__AVX2__)
+        __m256d acc0 = _mm256_setzero_pd();
+        __m256d acc1 = _mm256_setzero_pd();
+        for (; i + 8 <= n; i += 8) {
+#if defined(__FMA__)
+            acc0 = _mm256_fmadd_pd(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i), acc0);
+            acc1 = _mm256_fmadd_pd(_mm256_loadu_pd(a + i + 4), _mm256_loadu_pd(b + i + 4), acc1);
+#else
+            acc0 = _mm256_add_pd(acc0, _mm256_mul_pd(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i)));
+            acc1 = _mm256_add_pd(acc1, _mm256_mul_pd(_mm256_loadu_pd(a + i + 4), _mm256_loadu_pd(b + i + 4)));
+#endif
+        }
+        alignas(32) double lanes[4];
+        _mm256_store_pd(lanes, _mm256_add_pd(acc0, acc1));
+        total = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+#elif defined(__SSE2__)
+        __m128d acc0 = _mm_setzero_pd();
+        __m128d acc1 = _mm_setzero_pd();
+        for (; i + 4 <= n; i += 4) {
+            acc0 = _mm_add_pd(acc0, _mm_mul_pd(_mm_loadu_pd(a + i), _mm_loadu_pd(b + i)));
+            acc1 = _mm_add_pd(acc1, _mm_mul_pd(_mm_loadu_pd(a + i + 2), _mm_loadu_pd(b + i + 2)));
+        }
+        alignas(16) double lanes[2];
+        _mm_store_pd(lanes, _mm_add_pd(acc0, acc1));
+        total = lanes[0] + lanes[1];
+#endif
+        for (; i < n; ++i) {
+            total += a[i] * b[i];
+        }
+        return total;
+    }
+};
+
+// One element of a ShapeStore behind the Shape interface
+// Shape interface 뒤에 있는 ShapeStore의 요소 하나
+//
+// The view holds a reference to the store and a handle, not a copy of the
+// shape, so it sees later changes and must not outlive the store.
+// View는 도형의 복사본이 아니라 store에 대한 reference와 handle을 가지므로, 이후의
+// 변경을 볼 수 있으며 store보다 오래 살아서는 안 됨.
+class ShapeView : public Shape {
+private:
+    const ShapeStore* store;
+    ShapeStore::Handle handle;
+
+public:
+    ShapeView(const ShapeStore& s, ShapeStore::Handle h) : store(&s), handle(h) {}
+
+    double getArea() const override {
+        return store->area(handle);
+    }
+
+    const std::string& getColor() const override {
+        return store->color(handle);
+    }
+
+    void printInfo() const override {
+        std::cout << (handle.kind == ShapeStore::Kind::Circle ? "Circle Info:\n" : "Rectangle Info:\n");
+        Shape::printInfo();
+    }
+};
+
+inline ShapeView ShapeStore::view(Handle shape) const {
+    return ShapeView(*this, shape);
+}
+
+#endif // EX53_SHAPE_STORE_H
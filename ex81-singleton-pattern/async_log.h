@@ -0,0 +1,577 @@
+#ifndef EX81_ASYNC_LOG_H
+#define EX81_ASYNC_LOG_H
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include <unistd.h>
+
+#include "ring_buffer.h"
+
+// Asynchronous log with deferred, binary formatting
+// 지연된 binary formatting을 사용하는 비동기 log
+//
+// log(format, args...) does not format anything. The caller copies the
+// format pointer and the raw argument values into its own thread's ring
+// buffer and returns; no lock, no system call. A background writer thread
+// drains every thread's ring, formats the records printf-style, and writes
+// the text to the output file descriptor in large batches.
+// log(format, args...)는 아무것도 format하지 않음. 호출자는 format pointer와 인자의
+// 원시 값을 자기 thread의 ring buffer에 복사하고 반환함; lock도 system call도 없음.
+// Background writer thread가 모든 thread의 ring을 비우고, record를 printf 형식으로
+// format하여 text를 큰 batch로 output file descriptor에 기록함.
+//
+// The format must be a string literal (or otherwise outlive the log), because
+// only its address is stored. Arguments may be integers, floating-point
+// values, pointers, C strings, std::string and std::string_view; strings are
+// copied. Every call produces one line.
+// Format은 주소만 저장되므로 string literal이어야 함 (또는 log보다 오래 살아야 함).
+// 인자는 정수, 부동소수점 값, pointer, C string, std::string, std::string_view가
+// 가능하며 string은 복사됨. 호출마다 한 줄이 출력됨.
+class AsyncLog {
+public:
+    explicit AsyncLog(int fd = STDOUT_FILENO) : id(nextId()), output(fd), writer([this]() { run(); }) {}
+
+    AsyncLog(const AsyncLog&) = delete;
+    AsyncLog& operator=(const AsyncLog&) = delete;
+
+    // Write out every pending record, then stop the writer
+    // 대기 중인 모든 record를 기록한 뒤 writer를 정지
+    ~AsyncLog() {
+        stopRequested.store(true, std::memory_order_release);
+        wake();
+        writer.join();
+    }
+
+    // Queue one line; returns once the arguments are copied
+    // 한 줄을 queue에 넣음; 인자가 복사되면 반환
+    template<typename... Args>
+    void log(const char* format, const Args&... args) {
+        ThreadBuffer& buffer = localBuffer();
+        std::size_t size = (encodedSize(args) + ... + 0);
+        RecordWriter out(*this, buffer, format, size);
+        (encode(args, out), ...);
+        out.finish();
+    }
+
+    // Block until everything logged before the call has been written
+    // 호출 전에 log된 모든 내용이 기록될 때까지 대기
+    void flush() {
+        std::uint64_t ticket = flushRequests.fetch_add(1, std::memory_order_acq_rel) + 1;
+        wake();
+        std::unique_lock<std::mutex> lock(flushMutex);
+        flushed.wait(lock, [this, ticket]() { return flushesDone >= ticket; });
+    }
+
+    // Redirect the output (standard output by default); pending records are written first
+    // Output 대상을 변경 (기본값 standard output); 대기 중인 record를 먼저 기록
+    void setOutput(int fd) {
+        flush();
+        output.store(fd, std::memory_order_release);
+    }
+
+    // Number of times a caller found its ring full and had to wait
+    // 호출자가 ring이 가득 찬 것을 보고 기다려야 했던 횟수
+    std::uint64_t stalls() const {
+        return stallCount.load(std::memory_order_relaxed);
+    }
+
+private:
+    // Argument type tags stored in front of each encoded value
+    // 인코딩된 각 값 앞에 저장되는 인자 type tag
+    enum class Tag : std::uint8_t {
+        Int,     // std::int64_t
+        UInt,    // std::uint64_t
+        Double,  // double
+        Pointer, // const void*
+        String,  // std::uint32_t length, bytes, '\0'
+    };
+
+    // One ring cell; a line longer than one record continues in the next ones
+    // Ring cell 하나; record 하나보다 긴 줄은 다음 record들로 이어짐
+    struct LogRecord {
+        static constexpr std::size_t kPayload = 52;
+
+        const char* format;       // Only set in the first record of a line
+                                  // 줄의 첫 record에만 설정됨
+        std::uint16_t size;       // Encoded argument bytes of the whole line
+                                  // 줄 전체의 인코딩된 인자 byte 수
+        std::uint16_t extra;      // Continuation records that follow
+                                  // 뒤따르는 continuation record 수
+        char payload[kPayload];
+    };
+
+    static constexpr std::size_t kRecordsPerThread = 4096;
+    static constexpr std::size_t kMaxArgumentBytes = 65535;
+    static constexpr std::size_t kBatchBytes = 64 * 1024;
+    static constexpr std::chrono::milliseconds kIdleWait{10};
+
+    // The ring of one thread; it outlives the thread until the writer empties it
+    // Thread 하나의 ring; writer가 비울 때까지 thread보다 오래 살 수 있음
+    struct ThreadBuffer {
+        RingBuffer<LogRecord> records{kRecordsPerThread};
+        std::atomic<bool> closed{false};
+    };
+
+    // Per-thread handle that closes the buffer when the thread exits
+    // Thread가 종료되면 buffer를 닫는 thread별 handle
+    struct LocalBuffer {
+        std::uint64_t ownerId = 0; // AsyncLog::id, not the address, which a later log may reuse
+                                   // 주소가 아닌 AsyncLog::id; 주소는 나중의 log가 재사용할 수 있음
+        std::shared_ptr<ThreadBuffer> buffer;
+
+        ~LocalBuffer() {
+            if (buffer) {
+                buffer->closed.store(true, std::memory_order_release);
+            }
+        }
+    };
+
+    // Splits the encoded arguments of one line across ring records
+    // 한 줄의 인코딩된 인자를 ring record들에 나누어 기록
+    class RecordWriter {
+    public:
+        RecordWriter(AsyncLog& owner, ThreadBuffer& target, const char* format, std::size_t size)
+            : log(owner), buffer(target), used(0) {
+            if (size > kMaxArgumentBytes) {
+                size = kMaxArgumentBytes; // Longer lines lose their last bytes
+                                          // 더 긴 줄은 마지막 byte들이 잘림
+            }
+            remaining = size;
+            record.format = format;
+            record.size = static_cast<std::uint16_t>(size);
+            record.extra = static_cast<std::uint16_t>(size == 0 ? 0 : (size - 1) / LogRecord::kPayload);
+        }
+
+        void put(const void* data, std::size_t length) {
+            const char* bytes = static_cast<const char*>(data);
+            if (length > remaining) {
+                length = remaining;
+            }
+            remaining -= length;
+            while (length > 0) {
+                std::size_t chunk = std::min(length, LogRecord::kPayload - used);
+                std::memcpy(record.payload + used, bytes, chunk);
+                used += chunk;
+                bytes += chunk;
+                length -= chunk;
+                if (used == LogRecord::kPayload && (length > 0 || remaining > 0)) {
+                    push();
+                }
+            }
+        }
+
+        void finish() {
+            push();
+        }
+
+    private:
+        AsyncLog& log;
+        ThreadBuffer& buffer;
+        LogRecord record;
+        std::size_t used;
+        std::size_t remaining;
+
+        void push() {
+            if (!buffer.records.try_push(record)) {
+                log.stallCount.fetch_add(1, std::memory_order_relaxed);
+                do {
+                    log.wake();
+                    std::this_thread::yield();
+                } while (!buffer.records.try_push(record));
+            }
+            record.format = nullptr;
+            used = 0;
+        }
+    };
+
+    const std::uint64_t id;
+    std::atomic<int> output;
+
+    std::mutex buffersMutex;
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers; // Guarded by buffersMutex
+                                                        // buffersMutex로 보호됨
+    std::atomic<std::uint64_t> buffersVersion{0};
+
+    std::mutex wakeMutex;
+    std::condition_variable wakeUp;
+    std::atomic<std::uint64_t> wakeRequests{0};
+    std::atomic<bool> stopRequested{false};
+
+    std::mutex flushMutex;
+    std::condition_variable flushed;
+    std::atomic<std::uint64_t> flushRequests{0};
+    std::uint64_t flushesDone = 0; // Guarded by flushMutex
+                                   // flushMutex로 보호됨
+
+    std::atomic<std::uint64_t> stallCount{0};
+
+    std::thread writer; // Declared last so it starts after the members it uses
+                        // 사용하는 member 이후에 시작되도록 마지막에 선언
+
+    // The calling thread's buffer, registered with the writer on first use
+    // 호출 thread의 buffer, 처음 사용할 때 writer에 등록됨
+    ThreadBuffer& localBuffer() {
+        static thread_local LocalBuffer local;
+        if (local.ownerId != id) {
+            if (local.buffer) {
+                local.buffer->closed.store(true, std::memory_order_release);
+            }
+            local.buffer = std::make_shared<ThreadBuffer>();
+            local.ownerId = id;
+            std::lock_guard<std::mutex> lock(buffersMutex);
+            buffers.push_back(local.buffer);
+            buffersVersion.fetch_add(1, std::memory_order_release);
+        }
+        return *local.buffer;
+    }
+
+    // Ids start at 1, so a thread that has not logged yet matches no log
+    // Id는 1부터 시작하므로, 아직 log하지 않은 thread는 어떤 log와도 일치하지 않음
+    static std::uint64_t nextId() {
+        static std::atomic<std::uint64_t> next{0};
+        return next.fetch_add(1, std::memory_order_relaxed) + 1;
+    }
+
+    void wake() {
+        wakeRequests.fetch_add(1, std::memory_order_release);
+        std::lock_guard<std::mutex> lock(wakeMutex);
+        wakeUp.notify_one();
+    }
+
+    // Argument encoding: a tag byte followed by the value
+    // 인자 인코딩: tag byte 하나 뒤에 값
+    template<typename T>
+    static constexpr Tag tagOf() {
+        using D = std::decay_t<T>;
+        if constexpr (std::is_same_v<D, const char*> || std::is_same_v<D, char*> ||
+                      std::is_same_v<D, std::string> || std::is_same_v<D, std::string_view>) {
+            return Tag::String;
+        } else if constexpr (std::is_pointer_v<D> || std::is_null_pointer_v<D>) {
+            return Tag::Pointer;
+        } else if constexpr (std::is_floating_point_v<D>) {
+            return Tag::Double;
+        } else if constexpr (std::is_integral_v<D> && std::is_signed_v<D>) {
+            return Tag::Int;
+        } else if constexpr (std::is_integral_v<D> || std::is_enum_v<D>) {
+            return Tag::UInt;
+        } else {
+            static_assert(std::is_integral_v<D>, "unsupported AsyncLog argument type");
+            return Tag::Int;
+        }
+    }
+
+    template<typename T>
+    static std::string_view textOf(const T& value) {
+        using D = std::decay_t<T>;
+        if constexpr (std::is_array_v<T>) {
+            return std::string_view(value);
+        } else if constexpr (std::is_same_v<D, const char*> || std::is_same_v<D, char*>) {
+            return value != nullptr ? std::string_view(value) : std::string_view("(null)");
+        } else {
+            return std::string_view(value);
+        }
+    }
+
+    template<typename T>
+    static std::size_t encodedSize(const T& value) {
+        constexpr Tag tag = tagOf<T>();
+        if constexpr (tag == Tag::String) {
+            return 1 + sizeof(std::uint32_t) + textOf(value).size() + 1;
+        } else {
+            return 1 + 8; // Every other value is stored in 8 bytes
+                          // 그 외 모든 값은 8 byte로 저장됨
+        }
+    }
+
+    template<typename T>
+    static void encode(const T& value, RecordWriter& out) {
+        constexpr Tag tag = tagOf<T>();
+        out.put(&tag, 1);
+        if constexpr (tag == Tag::String) {
+            std::string_view text = textOf(value);
+            std::uint32_t length = static_cast<std::uint32_t>(text.size());
+            out.put(&length, sizeof(length));
+            out.put(text.data(), text.size());
+            out.put("", 1);
+        } else if constexpr (tag == Tag::Pointer) {
+            const void* pointer = value;
+            out.put(&pointer, 8);
+        } else if constexpr (tag == Tag::Double) {
+            double number = static_cast<double>(value);
+            out.put(&number, 8);
+        } else if constexpr (tag == Tag::Int) {
+            std::int64_t number = static_cast<std::int64_t>(value);
+            out.put(&number, 8);
+        } else {
+            std::uint64_t number = static_cast<std::uint64_t>(value);
+            out.put(&number, 8);
+        }
+    }
+
+    // Writer thread: drain, format, write; sleep when there is nothing to do
+    // Writer thread: 비우고, format하고, 기록함; 할 일이 없으면 대기
+    void run() {
+        std::vector<std::shared_ptr<ThreadBuffer>> local;
+        std::uint64_t seenVersion = ~std::uint64_t(0);
+        std::string text;
+        std::vector<char> arguments;
+        text.reserve(kBatchBytes + 4096);
+
+        while (true) {
+            std::uint64_t seenWakeups = wakeRequests.load(std::memory_order_acquire);
+            std::uint64_t ticket = flushRequests.load(std::memory_order_acquire);
+            bool stopping = stopRequested.load(std::memory_order_acquire);
+
+            std::uint64_t version = buffersVersion.load(std::memory_order_acquire);
+            if (version != seenVersion) {
+                std::lock_guard<std::mutex> lock(buffersMutex);
+                local = buffers;
+                seenVersion = version;
+            }
+
+            std::size_t drained = 0;
+            bool removeClosed = false;
+            for (const std::shared_ptr<ThreadBuffer>& buffer : local) {
+                bool closed = buffer->closed.load(std::memory_order_acquire);
+                drained += drain(*buffer, text, arguments);
+                removeClosed = removeClosed || closed;
+            }
+            writeOut(text);
+
+            if (removeClosed) {
+                // Closed buffers were emptied after their thread's last push
+                // 닫힌 buffer는 그 thread의 마지막 push 이후에 비워졌음
+                std::lock_guard<std::mutex> lock(buffersMutex);
+                for (std::size_t i = 0; i < buffers.size();) {
+                    if (buffers[i]->closed.load(std::memory_order_acquire) && buffers[i]->records.empty()) {
+                        buffers[i] = std::move(buffers.back());
+                        buffers.pop_back();
+                    } else {
+                        ++i;
+                    }
+                }
+                buffersVersion.fetch_add(1, std::memory_order_release);
+            }
+
+            if (ticket != 0) {
+                std::lock_guard<std::mutex> lock(flushMutex);
+                if (flushesDone < ticket) {
+                    flushesDone = ticket;
+                    flushed.notify_all();
+                }
+            }
+
+            if (drained == 0) {
+                if (stopping) {
+                    break;
+                }
+                std::unique_lock<std::mutex> lock(wakeMutex);
+                wakeUp.wait_for(lock, kIdleWait, [this, seenWakeups]() {
+                    return wakeRequests.load(std::memory_order_acquire) != seenWakeups;
+                });
+            }
+        }
+    }
+
+    // Format the records in one thread's ring; returns the number of lines
+    // Thread 하나의 ring에 있는 record를 format; 줄 수를 반환
+    std::size_t drain(ThreadBuffer& buffer, std::string& text, std::vector<char>& arguments) {
+        std::size_t lines = 0;
+        LogRecord record;
+        while (buffer.records.try_pop(record)) {
+            arguments.assign(record.payload, record.payload + std::min<std::size_t>(record.size, LogRecord::kPayload));
+            for (std::uint16_t i = 0; i < record.extra; ++i) {
+                // The producer is still pushing the rest of the line
+                // Producer가 아직 줄의 나머지를 push하는 중
+                LogRecord next;
+                while (!buffer.records.try_pop(next)) {
+                    std::this_thread::yield();
+                }
+                std::size_t take = std::min<std::size_t>(record.size - arguments.size(), LogRecord::kPayload);
+                arguments.insert(arguments.end(), next.payload, next.payload + take);
+            }
+            format(record.format, arguments, text);
+            ++lines;
+            if (text.size() >= kBatchBytes) {
+                writeOut(text);
+            }
+        }
+        return lines;
+    }
+
+    void writeOut(std::string& text) {
+        int fd = output.load(std::memory_order_acquire);
+        std::size_t done = 0;
+        while (done < text.size()) {
+            ssize_t n = ::write(fd, text.data() + done, text.size() - done);
+            if (n < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                break; // Nowhere to report a failing log output; drop the batch
+                       // 실패한 log output을 보고할 곳이 없음; batch를 버림
+            }
+            done += static_cast<std::size_t>(n);
+        }
+        text.clear();
+    }
+
+    // Append printf-style output of one spec to text
+    // Spec 하나의 printf 형식 출력을 text에 추가
+    template<typename T>
+    static void appendFormatted(std::string& text, const char* spec, T value) {
+        std::size_t old = text.size();
+        text.resize(old + 64);
+        int n = std::snprintf(&text[old], 64, spec, value);
+        if (n < 0) {
+            text.resize(old);
+            return;
+        }
+        if (static_cast<std::size_t>(n) >= 64) {
+            text.resize(old + static_cast<std::size_t>(n) + 1);
+            std::snprintf(&text[old], static_cast<std::size_t>(n) + 1, spec, value);
+        }
+        text.resize(old + static_cast<std::size_t>(n));
+    }
+
+    // Expand format with the decoded arguments and end the line
+    // Decode된 인자로 format을 전개하고 줄을 끝냄
+    static void format(const char* format, const std::vector<char>& arguments, std::string& text) {
+        const char* args = arguments.data();
+        const char* end = args + arguments.size();
+        const char* p = format != nullptr ? format : "";
+
+        while (*p != '\0') {
+            const char* percent = std::strchr(p, '%');
+            if (percent == nullptr) {
+                text += p;
+                break;
+            }
+            text.append(p, percent);
+            if (percent[1] == '%') {
+                text += '%';
+                p = percent + 2;
+                continue;
+            }
+
+            // Copy flags, width and precision; drop length modifiers
+            // Flag, width, precision을 복사; length modifier는 버림
+            char spec[32] = "%";
+            std::size_t length = 1;
+            const char* q = percent + 1;
+            while (*q != '\0' && std::strchr("-+ #0123456789.", *q) != nullptr && length < 24) {
+                spec[length++] = *q++;
+            }
+            while (*q != '\0' && std::strchr("hlLjztq", *q) != nullptr) {
+                ++q;
+            }
+            char conversion = *q;
+            p = (*q != '\0') ? q + 1 : q;
+
+            if (args >= end) {
+                text.append(percent, p); // Missing argument: keep the spec as text
+                                         // 인자 없음: spec을 text로 남김
+                continue;
+            }
+
+            Tag tag = static_cast<Tag>(*args++);
+            if (tag != Tag::String && end - args < 8) {
+                // Truncated line: the value did not arrive, so keep the spec as text
+                // 잘린 줄: 값이 도착하지 않았으므로 spec을 text로 남김
+                text.append(percent, p);
+                args = end;
+                continue;
+            }
+            auto conversionIn = [conversion](const char* set) {
+                return conversion != '\0' && std::strchr(set, conversion) != nullptr;
+            };
+            switch (tag) {
+            case Tag::Int:
+            case Tag::UInt: {
+                std::uint64_t bits;
+                std::memcpy(&bits, args, 8);
+                args += 8;
+                if (conversion == 'c') {
+                    std::strcpy(spec + length, "c");
+                    appendFormatted(text, spec, static_cast<int>(bits));
+                    break;
+                }
+                char type = conversionIn("diouxX") ? conversion : (tag == Tag::Int ? 'd' : 'u');
+                spec[length] = 'l';
+                spec[length + 1] = 'l';
+                spec[length + 2] = type;
+                spec[length + 3] = '\0';
+                if (tag == Tag::Int && (type == 'd' || type == 'i')) {
+                    appendFormatted(text, spec, static_cast<long long>(static_cast<std::int64_t>(bits)));
+                } else {
+                    appendFormatted(text, spec, static_cast<unsigned long long>(bits));
+                }
+                break;
+            }
+            case Tag::Double: {
+                double number;
+                std::memcpy(&number, args, 8);
+                args += 8;
+                spec[length] = conversionIn("fFeEgGaA") ? conversion : 'g';
+                spec[length + 1] = '\0';
+                appendFormatted(text, spec, number);
+                break;
+            }
+            case Tag::Pointer: {
+                const void* pointer;
+                std::memcpy(&pointer, args, 8);
+                args += 8;
+                spec[length] = 'p';
+                spec[length + 1] = '\0';
+                appendFormatted(text, spec, pointer);
+                break;
+            }
+            case Tag::String: {
+                std::uint32_t size = 0;
+                if (end - args >= static_cast<std::ptrdiff_t>(sizeof(size))) {
+                    std::memcpy(&size, args, sizeof(size));
+                    args += sizeof(size);
+                }
+                if (static_cast<std::size_t>(end - args) <= size) {
+                    // Truncated line: print what arrived
+                    // 잘린 줄: 도착한 부분만 출력
+                    text.append(args, end);
+                    args = end;
+                    break;
+                }
+                spec[length] = 's';
+                spec[length + 1] = '\0';
+                if (length == 1) {
+                    text.append(args, size); // Plain %s needs no snprintf
+                                             // 단순 %s는 snprintf가 필요 없음
+                } else {
+                    appendFormatted(text, spec, args);
+                }
+                args += size + 1;
+                break;
+            }
+            default:
+                args = end;
+                break;
+            }
+        }
+        text += '\n';
+    }
+};
+
+#endif // EX81_ASYNC_LOG_H
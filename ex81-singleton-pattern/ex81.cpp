@@ -1,53 +1,7 @@
 #include <iostream>
+#include <string>
 
-// Singleton class definition
-// Singleton class 정의
-class Singleton {
-public:
-    // Static method to get the single instance (returns reference)
-    // 단일 instance를 얻기 위한 static method (참조 반환)
-    static Singleton& getInstance() {
-        // Thread-safe initialization using static local variable (C++11 feature)
-        // Static local 변수를 사용한 thread-safe 초기화 (C++11 기능)
-        // The C++11 standard guarantees thread-safe initialization of static local variables
-        // C++11 표준은 static local 변수의 thread-safe 초기화를 보장함
-        static Singleton instance;
-        return instance;
-    }
-
-    // Delete copy constructor to prevent copying
-    // 복사를 방지하기 위해 복사 생성자 삭제
-    Singleton(const Singleton&) = delete;
-
-    // Delete copy assignment operator to prevent copying
-    // 복사를 방지하기 위해 복사 대입 연산자 삭제
-    Singleton& operator=(const Singleton&) = delete;
-
-    // Delete move constructor to prevent moving
-    // 이동을 방지하기 위해 이동 생성자 삭제
-    Singleton(Singleton&&) = delete;
-
-    // Delete move assignment operator to prevent moving
-    // 이동을 방지하기 위해 이동 대입 연산자 삭제
-    Singleton& operator=(Singleton&&) = delete;
-
-    // Method to print a message
-    // 메시지를 출력하는 method
-    void printMessage(const std::string& message) const {
-        std::cout << message << std::endl;
-    }
-
-private:
-    // Private constructor to prevent direct instantiation
-    // 직접 instantiation을 방지하기 위한 private constructor
-    Singleton() {
-        std::cout << "Constructor called" << std::endl;
-    }
-
-    // Destructor (private or default is fine for singletons)
-    // 소멸자 (singleton의 경우 private 또는 default 모두 가능)
-    ~Singleton() = default;
-};
+#include "singleton.h"
 
 int main() {
     // Get the first instance reference
@@ -62,10 +16,26 @@ int main() {
     // Singleton instance 사용
     instance1.printMessage("Testing singleton...");
 
-    // Verify both instances refer to the same object
-    // 두 instance가 같은 객체를 참조하는지 확인
-    std::cout << "Address of instance1: " << &instance1 << std::endl;
-    std::cout << "Address of instance2: " << &instance2 << std::endl;
+    // Verify both instances refer to the same object; the addresses are formatted by the log writer
+    // 두 instance가 같은 객체를 참조하는지 확인; 주소는 log writer가 format함
+    instance1.log("Address of instance1: %p", &instance1);
+    instance1.log("Address of instance2: %p", &instance2);
+
+    // Arguments are copied now and formatted later, printf-style
+    // 인자는 지금 복사되고 나중에 printf 형식으로 format됨
+    std::string sensor = "temperature";
+    instance2.log("Logged %s = %.1f (reading %d of %u)", sensor, 23.5, 1, 3u);
+
+    // Wait for the log before printing through std::cout directly
+    // std::cout으로 직접 출력하기 전에 log를 기다림
+    instance1.flush();
+
+    // Constant-initialized singleton and a per-thread cached reference
+    // Constant initialization된 singleton과 thread별 cache 참조
+    EagerSingleton& eager = EagerSingleton::getInstance();
+    Singleton& cached = threadCachedInstance<Singleton>();
+    eager.printMessage("Testing eager singleton...");
+    std::cout << "Cached reference is instance1? " << (&cached == &instance1 ? "Yes" : "No") << std::endl;
 
     return 0;
 }
@@ -0,0 +1,203 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "benchmark.h"
+#include "singleton.h"
+
+// getInstance() calls each thread makes per iteration
+// Iteration마다 각 thread가 수행하는 getInstance() 호출 수
+constexpr long kCallsPerThread = 1 << 20;
+
+// One iteration: numThreads threads each call access() kCallsPerThread times
+// Iteration 하나: numThreads개의 thread가 각각 access()를 kCallsPerThread번 호출
+//
+// doNotOptimize() keeps the compiler from folding the loop, so each call is
+// really made. With kCallsPerThread items per iteration the harness reports
+// wall time per call on each thread.
+// doNotOptimize()는 compiler가 loop를 접지 못하게 하므로 각 호출이 실제로 수행됨.
+// Iteration당 item이 kCallsPerThread개이므로 harness는 각 thread에서의 호출당 wall
+// time을 보고함.
+template<typename Access>
+void callAll(unsigned numThreads, Access access) {
+    std::vector<std::thread> threads;
+    for (unsigned i = 0; i < numThreads; ++i) {
+        threads.emplace_back([access]() {
+            for (long n = 0; n < kCallsPerThread; ++n) {
+                auto* instance = &access();
+                doNotOptimize(instance);
+            }
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+}
+
+using Clock = std::chrono::steady_clock;
+
+// Log calls each thread makes per measurement; every kSampleEvery-th call is timed
+// 측정마다 각 thread가 수행하는 log 호출 수; kSampleEvery번째 호출마다 시간을 측정
+constexpr int kLogCallsPerThread = 1 << 20;
+constexpr int kSampleEvery = 16;
+
+struct LogResult {
+    double callsPerSec;   // Calls returned to the callers
+                          // 호출자에게 반환된 호출
+    double writtenPerSec; // Lines formatted and written, including the final flush
+                          // 마지막 flush를 포함해 format되고 기록된 줄
+    double p50;
+    double p99;
+    double p999;
+    double max;           // Caller-side latency in ns
+                          // 호출자 쪽 지연 시간 (ns)
+};
+
+// numThreads threads each call logLine() kLogCallsPerThread times; flushAll() waits for the output
+// numThreads개의 thread가 각각 logLine()을 kLogCallsPerThread번 호출; flushAll()은 출력을 기다림
+template<typename LogLine, typename FlushAll>
+LogResult measureLog(unsigned numThreads, LogLine logLine, FlushAll flushAll) {
+    std::vector<std::vector<double>> samples(numThreads);
+
+    auto start = Clock::now();
+    std::vector<std::thread> threads;
+    for (unsigned t = 0; t < numThreads; ++t) {
+        threads.emplace_back([&samples, logLine, t]() {
+            std::vector<double>& latencies = samples[t];
+            latencies.reserve(kLogCallsPerThread / kSampleEvery);
+            for (int i = 0; i < kLogCallsPerThread; ++i) {
+                if (i % kSampleEvery == 0) {
+                    auto before = Clock::now();
+                    logLine(i);
+                    latencies.push_back(std::chrono::duration<double, std::nano>(Clock::now() - before).count());
+                } else {
+                    logLine(i);
+                }
+            }
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+    auto returned = Clock::now();
+    flushAll();
+    auto written = Clock::now();
+
+    std::vector<double> latencies;
+    for (const auto& perThread : samples) {
+        latencies.insert(latencies.end(), perThread.begin(), perThread.end());
+    }
+    std::sort(latencies.begin(), latencies.end());
+    auto at = [&latencies](double q) {
+        return latencies[static_cast<std::size_t>(q * (latencies.size() - 1))];
+    };
+
+    double calls = static_cast<double>(kLogCallsPerThread) * numThreads;
+    LogResult result;
+    result.callsPerSec = calls / std::chrono::duration<double>(returned - start).count();
+    result.writtenPerSec = calls / std::chrono::duration<double>(written - start).count();
+    result.p50 = at(0.50);
+    result.p99 = at(0.99);
+    result.p999 = at(0.999);
+    result.max = latencies.back();
+    return result;
+}
+
+void printLogResult(unsigned numThreads, const char* name, const LogResult& r) {
+    std::cout << std::setw(8) << numThreads << std::setw(8) << name << std::fixed << std::setprecision(2)
+              << std::setw(12) << r.callsPerSec / 1e6 << std::setw(12) << r.writtenPerSec / 1e6
+              << std::setprecision(0) << std::setw(9) << r.p50 << std::setw(9) << r.p99
+              << std::setw(10) << r.p999 << std::setw(10) << r.max << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    // Harness options (--format=csv, --samples=N, ...) are removed from argv
+    // Harness option (--format=csv, --samples=N, ...)은 argv에서 제거됨
+    auto bench = Benchmark<>::fromArgs(argc, argv);
+
+    // Maximum thread count: first argument, or the number of hardware threads
+    // 최대 thread 수: 첫 번째 인자 또는 hardware thread 수
+    unsigned maxThreads = std::thread::hardware_concurrency();
+    if (argc > 1) {
+        maxThreads = static_cast<unsigned>(std::atoi(argv[1]));
+    }
+    if (maxThreads == 0) {
+        maxThreads = 1;
+    }
+
+    // Construct the Meyers singleton before timing so only the access path is measured
+    // 접근 경로만 측정하도록 timing 전에 Meyers singleton을 생성
+    std::cout.setstate(std::ios::badbit);
+    Singleton::getInstance();
+    std::cout.clear();
+
+    const double calls = static_cast<double>(kCallsPerThread);
+    for (unsigned n = 1; n <= maxThreads; ++n) {
+        bench.section("getInstance(), " + std::to_string(n) + " thread(s), ns per call per thread");
+        bench.run("meyers", [n]() {
+            callAll(n, []() -> Singleton& { return Singleton::getInstance(); });
+        }, calls);
+        bench.run("eager", [n]() {
+            callAll(n, []() -> EagerSingleton& { return EagerSingleton::getInstance(); });
+        }, calls);
+        bench.run("thread-cache", [n]() {
+            callAll(n, []() -> Singleton& { return threadCachedInstance<Singleton>(); });
+        }, calls);
+    }
+
+    // The log comparison times calls one by one for its percentiles, so it
+    // is printed in table format only
+    // Log 비교는 백분위수를 위해 호출을 하나씩 측정하므로 table 형식에서만 출력됨
+    if (bench.reportFormat() != ReportFormat::Table) {
+        bench.report();
+        return 0;
+    }
+
+    // Both loggers write to /dev/null so the terminal is not measured
+    // Terminal이 측정되지 않도록 두 logger 모두 /dev/null에 기록
+    int nullFd = ::open("/dev/null", O_WRONLY);
+    std::ofstream nullFile("/dev/null");
+    Singleton& logger = Singleton::getInstance();
+    logger.setOutput(nullFd);
+
+    std::cout << std::endl << "Log calls: \"request %d took %.3f ms from %s\", output to /dev/null" << std::endl;
+    std::cout << std::setw(8) << "threads" << std::setw(8) << "log"
+              << std::setw(12) << "Mcalls/s" << std::setw(12) << "Mwritten/s"
+              << std::setw(9) << "p50 ns" << std::setw(9) << "p99 ns"
+              << std::setw(10) << "p99.9 ns" << std::setw(10) << "max ns" << std::endl;
+
+    for (unsigned n = 1; n <= maxThreads; ++n) {
+        // Original printMessage(): stream insertion and std::endl on std::cout
+        // 기존 printMessage(): std::cout에 stream 삽입과 std::endl
+        std::streambuf* terminal = std::cout.rdbuf(nullFile.rdbuf());
+        LogResult direct = measureLog(n, [](int i) {
+            std::cout << "request " << i << " took " << i * 0.25 << " ms from " << "client-17" << std::endl;
+        }, []() {});
+        std::cout.rdbuf(terminal);
+
+        std::uint64_t stallsBefore = logger.logStalls();
+        LogResult async = measureLog(n, [&logger](int i) {
+            logger.log("request %d took %.3f ms from %s", i, i * 0.25, "client-17");
+        }, [&logger]() { logger.flush(); });
+
+        printLogResult(n, "cout", direct);
+        printLogResult(n, "async", async);
+        std::cout << std::setw(8) << "" << "  async callers waited on a full ring "
+                  << logger.logStalls() - stallsBefore << " times" << std::endl;
+    }
+
+    logger.setOutput(STDOUT_FILENO);
+    ::close(nullFd);
+    bench.report();
+    return 0;
+}
@@ -0,0 +1,153 @@
+#ifndef EX81_SINGLETON_H
+#define EX81_SINGLETON_H
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+
+#include "async_log.h"
+
+// Singleton class definition; the single instance is the program's logging service
+// Singleton class 정의; 단일 instance는 program의 logging service임
+//
+// printMessage() and log() queue a line with the AsyncLog owned by the
+// instance and return without formatting or writing anything. Lines appear
+// on standard output shortly after, in order per thread; call flush() before
+// writing to std::cout directly.
+// printMessage()와 log()는 instance가 소유한 AsyncLog에 한 줄을 넣고 format이나
+// 쓰기 없이 반환함. 줄은 잠시 뒤 thread별 순서대로 standard output에 나타남;
+// std::cout에 직접 쓰기 전에 flush()를 호출해야 함.
+class Singleton {
+public:
+    // Static method to get the single instance (returns reference)
+    // 단일 instance를 얻기 위한 static method (참조 반환)
+    static Singleton& getInstance() {
+        // Thread-safe initialization using static local variable (C++11 feature)
+        // Static local 변수를 사용한 thread-safe 초기화 (C++11 기능)
+        // The C++11 standard guarantees thread-safe initialization of static local variables
+        // C++11 표준은 static local 변수의 thread-safe 초기화를 보장함
+        static Singleton instance;
+        return instance;
+    }
+
+    // Delete copy constructor to prevent copying
+    // 복사를 방지하기 위해 복사 생성자 삭제
+    Singleton(const Singleton&) = delete;
+
+    // Delete copy assignment operator to prevent copying
+    // 복사를 방지하기 위해 복사 대입 연산자 삭제
+    Singleton& operator=(const Singleton&) = delete;
+
+    // Delete move constructor to prevent moving
+    // 이동을 방지하기 위해 이동 생성자 삭제
+    Singleton(Singleton&&) = delete;
+
+    // Delete move assignment operator to prevent moving
+    // 이동을 방지하기 위해 이동 대입 연산자 삭제
+    Singleton& operator=(Singleton&&) = delete;
+
+    // Method to print a message (asynchronously)
+    // 메시지를 출력하는 method (비동기)
+    void printMessage(const std::string& message) const {
+        logger.log("%s", message);
+    }
+
+    // Queue a printf-style line; format must be a string literal
+    // printf 형식의 한 줄을 queue에 넣음; format은 string literal이어야 함
+    template<typename... Args>
+    void log(const char* format, const Args&... args) const {
+        logger.log(format, args...);
+    }
+
+    // Wait until every queued line has been written
+    // Queue에 있는 모든 줄이 기록될 때까지 대기
+    void flush() const {
+        logger.flush();
+    }
+
+    // Send the log to another file descriptor
+    // Log를 다른 file descriptor로 보냄
+    void setOutput(int fd) const {
+        logger.setOutput(fd);
+    }
+
+    // Number of calls that waited for a full ring
+    // 가득 찬 ring 때문에 기다린 호출 수
+    std::uint64_t logStalls() const {
+        return logger.stalls();
+    }
+
+private:
+    // Logging is thread-safe, so the const interface may use it
+    // Logging은 thread-safe하므로 const interface에서 사용할 수 있음
+    mutable AsyncLog logger;
+
+    // Private constructor to prevent direct instantiation
+    // 직접 instantiation을 방지하기 위한 private constructor
+    Singleton() {
+        std::cout << "Constructor called" << std::endl;
+    }
+
+    // Destructor (private or default is fine for singletons); writes out the pending log
+    // 소멸자 (singleton의 경우 private 또는 default 모두 가능); 대기 중인 log를 기록
+    ~Singleton() = default;
+};
+
+// Singleton that is constant-initialized instead of created on first use
+// 처음 사용할 때 생성되는 대신 constant initialization되는 singleton
+//
+// The constructor is constexpr and the instance is declared constinit, so the
+// compiler builds the object into the program image before any code runs.
+// getInstance() is then just the address of a global: no guard variable, no
+// branch and no initialization-order problem. The price is that the
+// constructor can only do work that is allowed in a constant expression.
+// Constructor가 constexpr이고 instance가 constinit으로 선언되므로, compiler는 어떤
+// code도 실행되기 전에 객체를 program image에 만들어 둠. 따라서 getInstance()는 전역
+// 변수의 주소일 뿐임: guard 변수, 분기, 초기화 순서 문제가 없음. 대신 constructor는
+// constant expression에서 허용되는 작업만 할 수 있음.
+class EagerSingleton {
+public:
+    // Static method to get the single instance; compiles to a constant address
+    // 단일 instance를 얻기 위한 static method; 상수 주소로 compile됨
+    static EagerSingleton& getInstance() {
+        return instance;
+    }
+
+    EagerSingleton(const EagerSingleton&) = delete;
+    EagerSingleton& operator=(const EagerSingleton&) = delete;
+    EagerSingleton(EagerSingleton&&) = delete;
+    EagerSingleton& operator=(EagerSingleton&&) = delete;
+
+    // Method to print a message
+    // 메시지를 출력하는 method
+    void printMessage(const std::string& message) const {
+        std::cout << message << std::endl;
+    }
+
+private:
+    static constinit EagerSingleton instance;
+
+    constexpr EagerSingleton() = default;
+    ~EagerSingleton() = default;
+};
+
+constinit inline EagerSingleton EagerSingleton::instance;
+
+// Per-thread cached reference to T::getInstance()
+// T::getInstance()에 대한 thread별 cache 참조
+//
+// The first call on each thread goes through T::getInstance(); later calls
+// read a thread_local pointer. The pointer has a constant initializer, so
+// reading it needs no guard of its own.
+// 각 thread의 첫 호출은 T::getInstance()를 거치고, 이후 호출은 thread_local pointer를
+// 읽음. Pointer는 상수 initializer를 가지므로 읽을 때 별도의 guard가 필요 없음.
+template<typename T>
+T& threadCachedInstance() {
+    static thread_local T* cached = nullptr;
+    if (cached == nullptr) {
+        cached = &T::getInstance();
+    }
+    return *cached;
+}
+
+#endif // EX81_SINGLETON_H
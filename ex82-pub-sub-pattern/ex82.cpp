@@ -1,41 +1,8 @@
 #include <iostream>
-#include <vector>
 #include <string>
 #include <memory>
 
-// Subscriber interface (abstract class)
-// Subscriber interface (추상 class)
-class Subscriber {
-public:
-    // Pure virtual function for receiving updates
-    // 업데이트를 받기 위한 순수 가상 함수
-    virtual void update(const std::string& message) = 0;
-    virtual ~Subscriber() = default;
-};
-
-// Publisher class that manages subscribers
-// Subscriber들을 관리하는 Publisher class
-class Publisher {
-private:
-    // List of subscribers using smart pointers
-    // Smart pointer를 사용한 subscriber 목록
-    std::vector<std::shared_ptr<Subscriber>> subscribers;
-
-public:
-    // Subscribe a new subscriber
-    // 새로운 subscriber 등록
-    void subscribe(const std::shared_ptr<Subscriber>& sub) {
-        subscribers.push_back(sub);
-    }
-
-    // Notify all subscribers with a message
-    // 모든 subscriber에게 메시지로 알림
-    void notify(const std::string& message) {
-        for (const auto& sub : subscribers) {
-            sub->update(message);
-        }
-    }
-};
+#include "pubsub.h"
 
 // Concrete implementation of Subscriber
 // Subscriber의 구체적 구현
@@ -50,12 +17,20 @@ public:
 
     // Override the update method to handle notifications
     // 알림을 처리하기 위해 update method override
-    void update(const std::string& message) override {
-        std::cout << name << " received: " << message << std::endl;
+    void update(const Message& message) override {
+        // Build the line first so lines from different workers don't interleave
+        // 서로 다른 worker의 출력이 섞이지 않도록 한 줄을 먼저 만듦
+        std::string line = name + " received: ";
+        line.append(message.view());
+        line += "\n";
+        std::cout << line << std::flush;
     }
 };
 
-int main() {
+int main(int argc, char* argv[]) {
+    InstrumentTraceSession trace(argc, argv); // --trace=FILE records every notify()
+                                              // --trace=FILE은 모든 notify()를 기록
+
     // Create a publisher
     // Publisher 생성
     auto publisher = std::make_shared<Publisher>();
@@ -74,5 +49,55 @@ int main() {
     // 모든 subscriber에게 메시지 발행
     publisher->notify("Hello, Subscribers!");
 
+    // Topic routing: sub1 wants one exact topic, sub2 everything under "sensor"
+    // Topic routing: sub1은 정확한 topic 하나를, sub2는 "sensor" 아래의 모든 topic을 원함
+    auto topicPublisher = std::make_shared<Publisher>();
+    topicPublisher->subscribe("sensor.kitchen.temp", sub1);
+    topicPublisher->subscribe("sensor.*", sub2);
+
+    topicPublisher->notify("sensor.kitchen.temp", "21.5C");  // sub1 and sub2
+                                                             // sub1과 sub2
+    topicPublisher->notify("sensor.garage.humidity", "40%"); // sub2 only
+                                                             // sub2만
+
+    // Batched publish: each subscriber gets both messages in one updateBatch() call
+    // Batch 발행: 각 subscriber가 두 메시지를 updateBatch() 호출 한 번으로 받음
+    const Message readings[] = {Message("19.0C"), Message("19.5C")};
+    topicPublisher->notifyBatch("sensor.kitchen.temp", readings);
+
+    // A lambda subscriber, stored inside the publisher instead of behind a shared_ptr
+    // shared_ptr 뒤가 아니라 publisher 안에 저장되는 lambda subscriber
+    int alerts = 0;
+    SubscriptionId alertId = topicPublisher->subscribe("sensor.*", [&alerts](const Message& message) {
+        ++alerts;
+        std::cout << "Alert " << alerts << ": " << message.view() << "\n";
+    });
+    topicPublisher->notify("sensor.door.open", "front door");  // sub2 and the lambda
+                                                              // sub2와 lambda
+    topicPublisher->unsubscribe(alertId);
+    topicPublisher->notify("sensor.door.open", "back door");   // sub2 only
+                                                              // sub2만
+
+    // Asynchronous publisher: each subscriber drains its own bounded queue
+    // 비동기 publisher: 각 subscriber가 자신의 bounded queue를 비움
+    auto asyncPublisher = std::make_shared<Publisher>(DispatchMode::Asynchronous, 64,
+                                                      Backpressure::DropOldest);
+    asyncPublisher->subscribe(sub1);
+    asyncPublisher->subscribe(sub2);
+    asyncPublisher->subscribe([](const Message& message) {
+        std::string line = "Lambda received: ";
+        line.append(message.view());
+        line += "\n";
+        std::cout << line << std::flush;
+    });
+
+    // notify() returns as soon as the message is queued
+    // notify()는 메시지가 queue에 들어가자마자 반환됨
+    asyncPublisher->notify("Hello, Async Subscribers!");
+
+    // Wait until all three subscribers have received the message
+    // 세 subscriber 모두 메시지를 받을 때까지 대기
+    asyncPublisher->flush();
+
     return 0;
 }
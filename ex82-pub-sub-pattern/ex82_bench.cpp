@@ -0,0 +1,625 @@
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <span>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "benchmark.h"
+#include "inplace_function.h"
+#include "pubsub.h"
+#include "ring_buffer.h"
+
+using Clock = std::chrono::steady_clock;
+
+// Messages published per configuration
+// 설정마다 발행하는 메시지 수
+constexpr int kMessages = 5000;
+
+// Per-subscriber queue capacity in asynchronous mode
+// 비동기 mode에서 subscriber별 queue capacity
+constexpr std::size_t kQueueCapacity = 256;
+
+// Subscriber that only counts what it receives
+// 받은 메시지 수만 세는 subscriber
+class CountingSubscriber : public Subscriber {
+public:
+    std::atomic<long> received{0};
+
+    void update(const Message& message) override {
+        received.fetch_add(static_cast<long>(message.size() > 0), std::memory_order_relaxed);
+    }
+};
+
+// Subscriber that burns a fixed amount of time per message
+// 메시지마다 일정 시간을 소모하는 subscriber
+class SlowSubscriber : public Subscriber {
+public:
+    explicit SlowSubscriber(std::chrono::microseconds cost) : workTime(cost) {}
+
+    void update(const Message&) override {
+        auto until = Clock::now() + workTime;
+        while (Clock::now() < until) {
+        }
+    }
+
+private:
+    std::chrono::microseconds workTime;
+};
+
+// Subscribers used by the payload benchmark
+// Payload 벤치마크에서 사용하는 subscriber 수
+constexpr int kPayloadSubscribers = 16;
+
+// Old string path: each subscriber queues its own copy of the text
+// 기존 string 경로: 각 subscriber가 text의 복사본을 queue에 넣음
+class StringQueue {
+public:
+    void update(const std::string& message) {
+        queue.try_push(std::string(message)); // One allocation and memcpy per subscriber
+                                              // Subscriber마다 한 번의 할당과 memcpy
+        std::string out;
+        queue.try_pop(out);
+    }
+
+private:
+    RingBuffer<std::string> queue{4};
+};
+
+// Shared path: each subscriber queues a reference to the pooled message
+// 공유 경로: 각 subscriber가 pool 메시지에 대한 참조를 queue에 넣음
+class MessageQueueSubscriber : public Subscriber {
+public:
+    void update(const Message& message) override {
+        queue.try_push(message); // Reference count increment only
+                                 // Reference count 증가만 수행
+        Message out;
+        queue.try_pop(out);
+    }
+
+private:
+    RingBuffer<Message> queue{4};
+};
+
+// One publish to kPayloadSubscribers queueing subscribers per iteration
+// Iteration마다 kPayloadSubscribers개의 queue 사용 subscriber에게 한 번 발행
+void stringPath(Benchmark<>& bench, const std::string& name, std::size_t payloadSize) {
+    std::vector<StringQueue> subscribers(kPayloadSubscribers);
+    const std::string text(payloadSize, 'x');
+
+    bench.run(name, [&]() {
+        std::string message(text); // The publisher's own copy, as notify(std::string) took
+                                   // notify(std::string)처럼 publisher 자신의 복사본
+        for (auto& sub : subscribers) {
+            sub.update(message);
+        }
+    });
+}
+
+void messagePath(Benchmark<>& bench, const std::string& name, std::size_t payloadSize) {
+    Publisher publisher;
+    for (int i = 0; i < kPayloadSubscribers; ++i) {
+        publisher.subscribe(std::make_shared<MessageQueueSubscriber>());
+    }
+    const std::string text(payloadSize, 'x');
+
+    bench.run(name, [&]() {
+        publisher.notify(text); // One pooled block shared by all subscribers
+                                // 모든 subscriber가 공유하는 하나의 pool block
+    });
+}
+
+// Baseline for the churn benchmark: a subscriber list guarded by one mutex
+// Churn 벤치마크의 기준: 하나의 mutex로 보호되는 subscriber 목록
+class LockedPublisher {
+public:
+    void subscribe(const std::shared_ptr<Subscriber>& sub) {
+        std::lock_guard<std::mutex> lock(mtx);
+        subscribers.push_back(sub);
+    }
+
+    bool unsubscribe(const std::shared_ptr<Subscriber>& sub) {
+        std::lock_guard<std::mutex> lock(mtx);
+        auto found = std::find(subscribers.begin(), subscribers.end(), sub);
+        if (found == subscribers.end()) {
+            return false;
+        }
+        subscribers.erase(found);
+        return true;
+    }
+
+    void notify(const Message& message) {
+        std::lock_guard<std::mutex> lock(mtx); // Held for the whole fan-out
+                                                // Fan-out 전체 동안 유지
+        for (const auto& sub : subscribers) {
+            sub->update(message);
+        }
+    }
+
+private:
+    std::mutex mtx;
+    std::vector<std::shared_ptr<Subscriber>> subscribers;
+};
+
+// Stable subscribers in the churn benchmark
+// Churn 벤치마크의 고정 subscriber 수
+constexpr int kStableSubscribers = 16;
+
+// Notify from this thread while another thread subscribes and unsubscribes
+// 다른 thread가 subscribe/unsubscribe하는 동안 이 thread에서 notify
+//
+// Stable subscribers must receive every message; anything else means the
+// membership change corrupted the list, so the benchmark doubles as a stress
+// test (build it with -fsanitize=thread to check for data races).
+// 고정 subscriber는 모든 메시지를 받아야 하며, 그렇지 않다면 membership 변경이 목록을
+// 손상시킨 것이므로 이 벤치마크는 stress test 역할도 함 (data race 검사를 위해
+// -fsanitize=thread로 build).
+template<typename PublisherType>
+void churn(Benchmark<>& bench, const std::string& name, bool withChurn) {
+    PublisherType publisher;
+    std::vector<std::shared_ptr<CountingSubscriber>> stable;
+    for (int i = 0; i < kStableSubscribers; ++i) {
+        stable.push_back(std::make_shared<CountingSubscriber>());
+        publisher.subscribe(stable.back());
+    }
+
+    std::atomic<bool> done{false};
+    std::atomic<long> churnOps{0};
+    std::thread churner;
+    if (withChurn) {
+        churner = std::thread([&]() {
+            auto transient = std::make_shared<CountingSubscriber>();
+            while (!done.load(std::memory_order_relaxed)) {
+                publisher.subscribe(transient);
+                publisher.unsubscribe(transient);
+                churnOps.fetch_add(2, std::memory_order_relaxed);
+            }
+        });
+    }
+
+    const Message message(std::string(64, 'x'));
+    long published = 0;
+    auto start = Clock::now();
+    bench.run(name, [&]() {
+        publisher.notify(message);
+        ++published;
+    });
+    double elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+
+    done.store(true);
+    if (churner.joinable()) {
+        churner.join();
+    }
+
+    for (const auto& sub : stable) {
+        if (sub->received.load() != published) {
+            std::cerr << "Stable subscriber missed messages: " << sub->received.load() << std::endl;
+            std::exit(1);
+        }
+    }
+    if (withChurn) {
+        bench.note("    " + name + ": " + std::to_string(static_cast<long>(churnOps.load() / elapsed))
+                   + " subscribe/unsubscribe ops/s");
+    }
+}
+
+// Routing benchmark: 10k subscribers spread across 1k topics
+// Routing 벤치마크: 1k개 topic에 분산된 10k개 subscriber
+constexpr int kGroups = 100;
+constexpr int kTopicsPerGroup = 10;
+constexpr int kExactPerTopic = 9;
+constexpr int kWildcardsPerGroup = 10;
+
+std::string topicName(int group, int topic) {
+    return "sensor.g" + std::to_string(group) + ".t" + std::to_string(topic);
+}
+
+// Baseline without an index: every publish checks every subscription
+// Index가 없는 기준: 모든 발행이 모든 subscription을 검사
+class ScanningPublisher {
+public:
+    void subscribe(const std::string& pattern, const std::shared_ptr<Subscriber>& sub) {
+        subscriptions.emplace_back(pattern, sub);
+    }
+
+    void notify(std::string_view topic, const Message& message) {
+        for (const auto& entry : subscriptions) {
+            if (matches(entry.first, topic)) {
+                entry.second->update(message);
+            }
+        }
+    }
+
+private:
+    std::vector<std::pair<std::string, std::shared_ptr<Subscriber>>> subscriptions;
+
+    static bool matches(std::string_view pattern, std::string_view topic) {
+        if (pattern.size() >= 2 && pattern.substr(pattern.size() - 2) == ".*") {
+            std::string_view prefix = pattern.substr(0, pattern.size() - 1); // Keep the dot
+                                                                             // 점은 유지
+            return topic.size() > prefix.size() && topic.substr(0, prefix.size()) == prefix;
+        }
+        return pattern == topic;
+    }
+};
+
+// One publish to a random topic per iteration; reports update() calls per publish
+// Iteration마다 무작위 topic으로 한 번 발행; 발행당 update() 호출 수를 보고
+template<typename PublisherType>
+void routed(Benchmark<>& bench, const std::string& name) {
+    PublisherType publisher;
+    std::vector<std::shared_ptr<CountingSubscriber>> subs;
+    for (int g = 0; g < kGroups; ++g) {
+        for (int t = 0; t < kTopicsPerGroup; ++t) {
+            for (int i = 0; i < kExactPerTopic; ++i) {
+                subs.push_back(std::make_shared<CountingSubscriber>());
+                publisher.subscribe(topicName(g, t), subs.back());
+            }
+        }
+        for (int i = 0; i < kWildcardsPerGroup; ++i) {
+            subs.push_back(std::make_shared<CountingSubscriber>());
+            publisher.subscribe("sensor.g" + std::to_string(g) + ".*", subs.back());
+        }
+    }
+
+    std::vector<std::string> topics;
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> group(0, kGroups - 1);
+    std::uniform_int_distribution<int> topic(0, kTopicsPerGroup - 1);
+    for (int i = 0; i < 1024; ++i) {
+        topics.push_back(topicName(group(rng), topic(rng)));
+    }
+
+    const Message message(std::string(64, 'x'));
+    std::size_t published = 0;
+    bench.run(name, [&]() {
+        publisher.notify(topics[published & 1023], message);
+        ++published;
+    });
+
+    long deliveries = 0;
+    for (const auto& sub : subs) {
+        deliveries += sub->received.load();
+    }
+    char line[96];
+    std::snprintf(line, sizeof(line), "    %s: %.1f deliveries per publish", name.c_str(),
+                  static_cast<double>(deliveries) / static_cast<double>(published));
+    bench.note(line);
+}
+
+// Subscriber that handles a whole batch per call
+// 호출마다 batch 전체를 처리하는 subscriber
+class BatchCountingSubscriber : public Subscriber {
+public:
+    std::atomic<long> received{0};
+
+    void update(const Message& message) override {
+        received.fetch_add(static_cast<long>(message.size() > 0), std::memory_order_relaxed);
+    }
+
+    void updateBatch(std::span<const Message> messages) override {
+        long count = 0;
+        for (const Message& message : messages) {
+            count += static_cast<long>(message.size() > 0);
+        }
+        received.fetch_add(count, std::memory_order_relaxed);
+    }
+};
+
+// Batch benchmark: messages per iteration and subscribers (half override updateBatch)
+// Batch 벤치마크: iteration마다의 메시지 수와 subscriber 수 (절반은 updateBatch를 override)
+constexpr int kBatchMessages = 1 << 14;
+constexpr int kBatchSubscribers = 16;
+
+// One iteration publishes kBatchMessages in batches of batchSize and waits for delivery
+// Iteration 하나는 kBatchMessages개를 batchSize 크기의 batch로 발행하고 전달을 기다림
+//
+// The messages are built up front, so the result is the dispatch cost alone.
+// 메시지는 미리 만들어 두므로 결과는 dispatch 비용만을 나타냄.
+void batched(Benchmark<>& bench, const std::string& name, DispatchMode mode, std::size_t batchSize) {
+    Publisher publisher(mode, kQueueCapacity, Backpressure::Block);
+    std::vector<std::shared_ptr<CountingSubscriber>> counters;
+    std::vector<std::shared_ptr<BatchCountingSubscriber>> batchCounters;
+    for (int i = 0; i < kBatchSubscribers / 2; ++i) {
+        counters.push_back(std::make_shared<CountingSubscriber>());
+        batchCounters.push_back(std::make_shared<BatchCountingSubscriber>());
+        publisher.subscribe(counters.back());
+        publisher.subscribe(batchCounters.back());
+    }
+
+    const std::vector<Message> messages(kBatchMessages, Message(std::string(64, 'x')));
+    std::span<const Message> all(messages);
+
+    BenchmarkOptions options = bench.defaults();
+    options.samples = std::min(options.samples, 10);
+    long runs = 0;
+    bench.run(name, options, [&]() {
+        for (std::size_t offset = 0; offset < all.size(); offset += batchSize) {
+            std::span<const Message> batch = all.subspan(offset, std::min(batchSize, all.size() - offset));
+            if (batchSize == 1) {
+                publisher.notify(batch.front());
+            } else {
+                publisher.notifyBatch(batch);
+            }
+        }
+        publisher.flush();
+        ++runs;
+    }, kBatchMessages);
+
+    for (int i = 0; i < kBatchSubscribers / 2; ++i) {
+        if (counters[i]->received.load() != runs * kBatchMessages
+            || batchCounters[i]->received.load() != runs * kBatchMessages) {
+            std::cerr << "batch: a subscriber missed messages" << std::endl;
+            std::exit(1);
+        }
+    }
+}
+
+// Subscribers called per iteration in the callable benchmarks
+// Callable 벤치마크에서 iteration마다 호출하는 subscriber 수
+constexpr int kCallables = 16;
+
+// Counts without atomics, so the cost of reaching update() dominates
+// Atomic 없이 세므로 update()에 도달하는 비용이 대부분을 차지함
+class PlainCountingSubscriber : public Subscriber {
+public:
+    long received = 0;
+
+    void update(const Message& message) override {
+        received += static_cast<long>(message.size() > 0);
+    }
+};
+
+// The lambda behind every callable path: its own counter and three size limits,
+// 32 bytes of captures, more than the 16 bytes std::function keeps inline in libstdc++
+// 모든 callable 경로에 쓰이는 lambda: 자신의 counter와 크기 제한 세 개로 capture가
+// 32 byte이며, libstdc++에서 std::function이 inline으로 보관하는 16 byte보다 큼
+auto makeCounter(long& received, std::size_t minSize) {
+    std::array<std::size_t, 3> limits = {minSize, minSize + 1, minSize + 2};
+    return [&received, limits](const Message& message) {
+        received += static_cast<long>(message.size() > limits[0]);
+    };
+}
+
+using CountingLambda = decltype(makeCounter(std::declval<long&>(), 0));
+
+// The same kCallables subscribers behind a virtual update(), std::function,
+// SubscriberCallback and FunctionRef
+// 같은 kCallables개의 subscriber를 virtual update(), std::function, SubscriberCallback,
+// FunctionRef 뒤에 둠
+void callables(Benchmark<>& bench) {
+    const Message message(std::string(64, 'x'));
+    std::vector<long> received(4 * kCallables); // One counter per lambda, as each subscriber has its own
+                                                 // Subscriber마다 자신의 counter가 있듯이 lambda마다 counter 하나
+
+    std::vector<std::shared_ptr<Subscriber>> subscribers;
+    std::vector<CountingLambda> lambdas;
+    std::vector<std::function<void(const Message&)>> functions;
+    std::vector<SubscriberCallback> inplace;
+    std::vector<FunctionRef<void(const Message&)>> refs;
+    for (int i = 0; i < kCallables; ++i) {
+        subscribers.push_back(std::make_shared<PlainCountingSubscriber>());
+        lambdas.push_back(makeCounter(received[i], 0));
+        functions.emplace_back(makeCounter(received[kCallables + i], 0));
+        inplace.emplace_back(makeCounter(received[2 * kCallables + i], 0));
+    }
+    for (const CountingLambda& lambda : lambdas) {
+        refs.emplace_back(lambda);
+    }
+
+    bench.section("Call " + std::to_string(kCallables) + " subscribers, ns per call");
+    auto virtualRow = bench.run("virtual update() via shared_ptr", [&]() {
+        for (const auto& sub : subscribers) {
+            sub->update(message);
+        }
+        clobberMemory();
+    }, kCallables);
+    auto functionRow = bench.run("std::function", [&]() {
+        for (const auto& function : functions) {
+            function(message);
+        }
+        clobberMemory();
+    }, kCallables);
+    auto inplaceRow = bench.run("SubscriberCallback (InplaceFunction)", [&]() {
+        for (const auto& callback : inplace) {
+            callback(message);
+        }
+        clobberMemory();
+    }, kCallables);
+    auto refRow = bench.run("FunctionRef", [&]() {
+        for (const auto& ref : refs) {
+            ref(message);
+        }
+        clobberMemory();
+    }, kCallables);
+    bench.noteSpeedup(virtualRow, functionRow);
+    bench.noteSpeedup(virtualRow, inplaceRow);
+    bench.noteSpeedup(virtualRow, refRow);
+
+    // Building and destroying kCallables subscribers; the vectors keep their capacity
+    // kCallables개의 subscriber를 만들고 파괴; vector는 capacity를 유지함
+    bench.section("Create " + std::to_string(kCallables) + " subscribers, ns per subscriber");
+    auto sharedRow = bench.run("make_shared<Subscriber>", [&]() {
+        subscribers.clear();
+        for (int i = 0; i < kCallables; ++i) {
+            subscribers.push_back(std::make_shared<PlainCountingSubscriber>());
+        }
+        clobberMemory();
+    }, kCallables);
+    auto functionBuildRow = bench.run("std::function", [&]() {
+        functions.clear();
+        for (int i = 0; i < kCallables; ++i) {
+            functions.emplace_back(makeCounter(received[kCallables + i], 0));
+        }
+        clobberMemory();
+    }, kCallables);
+    auto inplaceBuildRow = bench.run("SubscriberCallback (InplaceFunction)", [&]() {
+        inplace.clear();
+        for (int i = 0; i < kCallables; ++i) {
+            inplace.emplace_back(makeCounter(received[2 * kCallables + i], 0));
+        }
+        clobberMemory();
+    }, kCallables);
+    auto refBuildRow = bench.run("FunctionRef", [&]() {
+        refs.clear();
+        for (const CountingLambda& lambda : lambdas) {
+            refs.emplace_back(lambda);
+        }
+        clobberMemory();
+    }, kCallables);
+    bench.noteSpeedup(sharedRow, functionBuildRow);
+    bench.noteSpeedup(sharedRow, inplaceBuildRow);
+    bench.noteSpeedup(sharedRow, refBuildRow);
+
+    // The same fan-out through Publisher::notify()
+    // Publisher::notify()를 통한 같은 fan-out
+    bench.section("Notify " + std::to_string(kCallables) + " subscribers through Publisher, ns per publish");
+    Publisher virtualPublisher;
+    Publisher lambdaPublisher;
+    for (int i = 0; i < kCallables; ++i) {
+        virtualPublisher.subscribe(std::make_shared<PlainCountingSubscriber>());
+        lambdaPublisher.subscribe(makeCounter(received[3 * kCallables + i], 0));
+    }
+    auto virtualNotifyRow = bench.run("shared_ptr<Subscriber>", [&]() {
+        virtualPublisher.notify(message);
+    });
+    auto lambdaNotifyRow = bench.run("lambda subscribers", [&]() {
+        lambdaPublisher.notify(message);
+        clobberMemory();
+    });
+    bench.noteSpeedup(virtualNotifyRow, lambdaNotifyRow);
+}
+
+struct Result {
+    double p50;
+    double p99;
+    double p999;
+    double messagesPerSec;
+    std::uint64_t dropped;
+};
+
+// Publish kMessages through a publisher with numSubscribers (one of them slow)
+// numSubscribers개의 subscriber (그중 하나는 느림)를 가진 publisher로 kMessages개를 발행
+Result run(DispatchMode mode, Backpressure policy, int numSubscribers) {
+    Publisher publisher(mode, kQueueCapacity, policy);
+    publisher.subscribe(std::make_shared<SlowSubscriber>(std::chrono::microseconds(20)));
+    for (int i = 1; i < numSubscribers; ++i) {
+        publisher.subscribe(std::make_shared<CountingSubscriber>());
+    }
+
+    const std::string message(64, 'x');
+    std::vector<double> latencies;
+    latencies.reserve(kMessages);
+
+    auto start = Clock::now();
+    for (int i = 0; i < kMessages; ++i) {
+        auto before = Clock::now();
+        publisher.notify(message);
+        latencies.push_back(std::chrono::duration<double, std::micro>(Clock::now() - before).count());
+    }
+    auto end = Clock::now();
+    publisher.flush();
+
+    std::sort(latencies.begin(), latencies.end());
+    auto at = [&latencies](double q) {
+        return latencies[static_cast<std::size_t>(q * (latencies.size() - 1))];
+    };
+
+    Result result;
+    result.p50 = at(0.50);
+    result.p99 = at(0.99);
+    result.p999 = at(0.999);
+    result.messagesPerSec = kMessages / std::chrono::duration<double>(end - start).count();
+    result.dropped = publisher.dropped();
+    return result;
+}
+
+int main(int argc, char* argv[]) {
+    // Harness options (--format=csv, --samples=N, ...)
+    // Harness option (--format=csv, --samples=N, ...)
+    auto bench = Benchmark<>::fromArgs(argc, argv);
+
+    // Per-publish latency percentiles need one timestamp per call, so this
+    // table is measured directly and only printed in table format
+    // 발행별 지연 시간 백분위수는 호출마다 timestamp가 필요하므로, 이 table은 직접
+    // 측정하며 table 형식에서만 출력됨
+    if (bench.reportFormat() == ReportFormat::Table) {
+        struct Mode {
+            const char* name;
+            DispatchMode dispatch;
+            Backpressure policy;
+        };
+        const Mode modes[] = {
+            {"sync", DispatchMode::Synchronous, Backpressure::Block},
+            {"async-block", DispatchMode::Asynchronous, Backpressure::Block},
+            {"async-drop-oldest", DispatchMode::Asynchronous, Backpressure::DropOldest},
+            {"async-drop-newest", DispatchMode::Asynchronous, Backpressure::DropNewest},
+        };
+
+        std::cout << "Publish latency (us) and throughput, one subscriber takes 20us per message"
+                  << std::endl;
+        std::cout << std::setw(20) << "mode" << std::setw(6) << "subs"
+                  << std::setw(10) << "p50" << std::setw(10) << "p99" << std::setw(10) << "p999"
+                  << std::setw(14) << "msgs/sec" << std::setw(10) << "dropped" << std::endl;
+
+        for (const Mode& mode : modes) {
+            for (int subs = 1; subs <= 64; subs *= 2) {
+                Result r = run(mode.dispatch, mode.policy, subs);
+                std::cout << std::setw(20) << mode.name << std::setw(6) << subs
+                          << std::fixed << std::setprecision(2)
+                          << std::setw(10) << r.p50 << std::setw(10) << r.p99 << std::setw(10) << r.p999
+                          << std::setprecision(0) << std::setw(14) << r.messagesPerSec
+                          << std::setw(10) << r.dropped << std::endl;
+            }
+        }
+    }
+
+    bench.section("Notify with " + std::to_string(kStableSubscribers)
+                  + " subscribers while another thread churns the list, ns per publish");
+    churn<Publisher>(bench, "snapshot (RCU)", false);
+    churn<LockedPublisher>(bench, "mutex", false);
+    churn<Publisher>(bench, "snapshot (RCU) + churn", true);
+    churn<LockedPublisher>(bench, "mutex + churn", true);
+
+    bench.section("Topic routing with "
+                  + std::to_string(kGroups * kTopicsPerGroup * kExactPerTopic + kGroups * kWildcardsPerGroup)
+                  + " subscribers across " + std::to_string(kGroups * kTopicsPerGroup) + " topics, ns per publish");
+    routed<Publisher>(bench, "topic index");
+    routed<ScanningPublisher>(bench, "scan all");
+
+    bench.section("Payload fan-out to " + std::to_string(kPayloadSubscribers)
+                  + " queueing subscribers, ns per publish");
+    struct Payload {
+        const char* name;
+        std::size_t size;
+    };
+    const Payload payloads[] = {
+        {"64 B", 64},
+        {"4 KB", 4096},
+        {"1 MB", 1 << 20},
+    };
+    for (const Payload& payload : payloads) {
+        stringPath(bench, std::string("std::string ") + payload.name, payload.size);
+        messagePath(bench, std::string("Message ") + payload.name, payload.size);
+    }
+
+    bench.section("Batched publish to " + std::to_string(kBatchSubscribers) + " subscribers, ns per message");
+    for (std::size_t batchSize : {1, 8, 64, 512}) {
+        batched(bench, "sync, batch " + std::to_string(batchSize), DispatchMode::Synchronous, batchSize);
+        batched(bench, "async, batch " + std::to_string(batchSize), DispatchMode::Asynchronous, batchSize);
+    }
+
+    callables(bench);
+
+    bench.report();
+    return 0;
+}
@@ -0,0 +1,188 @@
+#ifndef EX82_MESSAGE_H
+#define EX82_MESSAGE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <new>
+#include <string_view>
+#include <utility>
+
+// Pool of message blocks grouped into power-of-two size classes
+// 2의 거듭제곱 size class로 묶인 message block pool
+//
+// Released blocks go back to a per-class free list and are reused by the next
+// message of the same class, so steady-state publishing does not call the
+// global allocator. Blocks larger than the biggest class bypass the pool.
+// 해제된 block은 class별 free list로 돌아가고 같은 class의 다음 메시지가 재사용하므로,
+// 정상 상태의 발행에서는 global allocator를 호출하지 않음. 가장 큰 class보다 큰
+// block은 pool을 거치지 않음.
+class MessagePool {
+public:
+    static constexpr std::size_t kMinShift = 6;        // Smallest class: 64 bytes
+                                                       // 가장 작은 class: 64 byte
+    static constexpr std::size_t kNumClasses = 16;     // Largest class: 2 MB
+                                                       // 가장 큰 class: 2 MB
+    static constexpr std::size_t kMaxCachedBlocks = 64; // Per class, bounds idle memory
+                                                        // Class별, 유휴 메모리 제한
+    static constexpr unsigned kUnpooled = kNumClasses;
+
+    static MessagePool& instance() {
+        static MessagePool pool;
+        return pool;
+    }
+
+    MessagePool(const MessagePool&) = delete;
+    MessagePool& operator=(const MessagePool&) = delete;
+
+    // Allocate at least bytes; sizeClass receives the class to pass to release()
+    // 최소 bytes만큼 할당; sizeClass에는 release()에 넘길 class가 저장됨
+    void* allocate(std::size_t bytes, unsigned& sizeClass) {
+        sizeClass = classFor(bytes);
+        if (sizeClass == kUnpooled) {
+            return ::operator new(bytes);
+        }
+        SizeClass& cls = classes[sizeClass];
+        {
+            std::lock_guard<std::mutex> lock(cls.mtx);
+            if (cls.head != nullptr) {
+                FreeNode* node = cls.head;
+                cls.head = node->next;
+                --cls.cached;
+                return node;
+            }
+        }
+        return ::operator new(classBytes(sizeClass));
+    }
+
+    void release(void* block, unsigned sizeClass) {
+        if (sizeClass != kUnpooled) {
+            SizeClass& cls = classes[sizeClass];
+            std::lock_guard<std::mutex> lock(cls.mtx);
+            if (cls.cached < kMaxCachedBlocks) {
+                FreeNode* node = static_cast<FreeNode*>(block);
+                node->next = cls.head;
+                cls.head = node;
+                ++cls.cached;
+                return;
+            }
+        }
+        ::operator delete(block);
+    }
+
+private:
+    struct FreeNode {
+        FreeNode* next;
+    };
+
+    struct SizeClass {
+        std::mutex mtx;
+        FreeNode* head = nullptr;
+        std::size_t cached = 0;
+    };
+
+    SizeClass classes[kNumClasses];
+
+    MessagePool() = default;
+
+    ~MessagePool() {
+        for (SizeClass& cls : classes) {
+            while (cls.head != nullptr) {
+                FreeNode* node = cls.head;
+                cls.head = node->next;
+                ::operator delete(node);
+            }
+        }
+    }
+
+    static std::size_t classBytes(unsigned sizeClass) {
+        return std::size_t(1) << (kMinShift + sizeClass);
+    }
+
+    static unsigned classFor(std::size_t bytes) {
+        for (unsigned c = 0; c < kNumClasses; ++c) {
+            if (bytes <= classBytes(c)) {
+                return c;
+            }
+        }
+        return kUnpooled;
+    }
+};
+
+// Immutable, reference-counted message payload
+// 불변이며 reference count를 가지는 message payload
+//
+// The text is copied once into a pooled block when the message is created.
+// Copying a Message only bumps the reference count, so every subscriber and
+// every queue shares that single block and reads it through view().
+// Text는 message 생성 시 pool block에 한 번만 복사됨. Message 복사는 reference
+// count만 증가시키므로 모든 subscriber와 queue가 하나의 block을 공유하며 view()로 읽음.
+class Message {
+public:
+    Message() = default;
+
+    explicit Message(std::string_view text) {
+        unsigned sizeClass;
+        void* memory = MessagePool::instance().allocate(sizeof(Header) + text.size(), sizeClass);
+        header = new (memory) Header{{1}, sizeClass, text.size()};
+        std::memcpy(payload(), text.data(), text.size());
+    }
+
+    Message(const Message& other) : header(other.header) {
+        if (header != nullptr) {
+            header->refs.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    Message(Message&& other) noexcept : header(other.header) {
+        other.header = nullptr;
+    }
+
+    Message& operator=(const Message& other) {
+        Message copy(other);
+        std::swap(header, copy.header);
+        return *this;
+    }
+
+    Message& operator=(Message&& other) noexcept {
+        Message moved(std::move(other)); // Releases our old payload on scope exit
+                                         // Scope를 벗어날 때 기존 payload를 해제
+        std::swap(header, moved.header);
+        return *this;
+    }
+
+    ~Message() {
+        if (header != nullptr && header->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            unsigned sizeClass = header->sizeClass;
+            header->~Header();
+            MessagePool::instance().release(header, sizeClass);
+        }
+    }
+
+    // Read-only view of the shared payload
+    // 공유 payload에 대한 읽기 전용 view
+    std::string_view view() const {
+        return header == nullptr ? std::string_view() : std::string_view(payload(), header->size);
+    }
+
+    std::size_t size() const {
+        return header == nullptr ? 0 : header->size;
+    }
+
+private:
+    struct Header {
+        std::atomic<std::uint32_t> refs;
+        unsigned sizeClass;
+        std::size_t size;
+    };
+
+    Header* header = nullptr;
+
+    char* payload() const {
+        return reinterpret_cast<char*>(header + 1);
+    }
+};
+
+#endif // EX82_MESSAGE_H
@@ -0,0 +1,725 @@
+#ifndef EX82_PUBSUB_H
+#define EX82_PUBSUB_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "inplace_function.h"
+#include "instrument.h"
+#include "message.h"
+#include "ring_buffer.h"
+#include "topic_index.h"
+
+// Subscriber interface (abstract class)
+// Subscriber interface (추상 class)
+class Subscriber {
+public:
+    // Pure virtual function for receiving updates
+    // 업데이트를 받기 위한 순수 가상 함수
+    //
+    // The message is shared with every other subscriber; keep a copy of the
+    // Message (not of its text) to hold on to it
+    // 메시지는 다른 모든 subscriber와 공유됨; 보관하려면 text가 아니라 Message를 복사
+    virtual void update(const Message& message) = 0;
+
+    // Receive several messages in one call; the default forwards to update()
+    // 여러 메시지를 한 번의 호출로 받음; 기본 구현은 update()로 전달
+    //
+    // Override it to handle a whole batch per virtual call.
+    // Virtual 호출 한 번에 batch 전체를 처리하려면 override.
+    virtual void updateBatch(std::span<const Message> messages) {
+        for (const Message& message : messages) {
+            update(message);
+        }
+    }
+
+    virtual ~Subscriber() = default;
+};
+
+// Lambda subscriber, stored in place inside the publisher; 48 bytes of captures
+// plus the two function pointers make the object 64 bytes
+// Publisher 안에 직접 저장되는 lambda subscriber; capture 48 byte와 function pointer
+// 두 개로 객체는 64 byte가 됨
+using SubscriberCallback = InplaceFunction<void(const Message&), 48>;
+static_assert(sizeof(SubscriberCallback) == 64, "SubscriberCallback should fill one cache line");
+
+// Returned by subscribe() for a callback, to unsubscribe it later
+// Callback에 대한 subscribe()가 반환하며, 나중에 unsubscribe할 때 사용
+struct SubscriptionId {
+    std::uint64_t value = 0;
+};
+
+// Subscriber that forwards to a callback owned elsewhere; used to give a
+// lambda subscriber a mailbox in asynchronous mode
+// 다른 곳이 소유한 callback으로 전달하는 subscriber; 비동기 mode에서 lambda
+// subscriber에게 mailbox를 주기 위해 사용
+class CallbackSubscriber : public Subscriber {
+public:
+    explicit CallbackSubscriber(FunctionRef<void(const Message&)> f) : callback(f) {}
+
+    void update(const Message& message) override {
+        callback(message);
+    }
+
+private:
+    FunctionRef<void(const Message&)> callback;
+};
+
+// How notify() delivers messages
+// notify()가 메시지를 전달하는 방식
+enum class DispatchMode {
+    Synchronous,  // update() runs on the publishing thread
+                  // update()가 발행하는 thread에서 실행됨
+    Asynchronous  // Each subscriber has a queue drained by its own worker
+                  // 각 subscriber가 자신의 worker가 비우는 queue를 가짐
+};
+
+// What an asynchronous publish does when a subscriber's queue is full
+// 비동기 발행 시 subscriber의 queue가 가득 찼을 때의 동작
+enum class Backpressure {
+    Block,       // Wait until the subscriber frees a slot
+                 // Subscriber가 slot을 비울 때까지 대기
+    DropOldest,  // Discard the oldest queued message to make room
+                 // 공간을 만들기 위해 가장 오래된 메시지를 버림
+    DropNewest   // Discard the message being published
+                 // 발행 중인 메시지를 버림
+};
+
+// Batch of messages shared by every mailbox it is posted to
+// Post되는 모든 mailbox가 공유하는 메시지 batch
+using MessageBatch = std::shared_ptr<const std::vector<Message>>;
+
+// Bounded queue plus worker thread that delivers messages to one subscriber
+// 하나의 subscriber에게 메시지를 전달하는 bounded queue와 worker thread
+class Mailbox {
+public:
+    Mailbox(std::shared_ptr<Subscriber> sub, std::size_t capacity, Backpressure policy)
+        : target(std::move(sub)), queue(capacity), backpressure(policy) {
+        worker = std::thread(&Mailbox::run, this);
+    }
+
+    // Deliver everything still queued, then stop the worker
+    // 아직 queue에 남은 모든 메시지를 전달한 뒤 worker를 정지
+    ~Mailbox() {
+        stopping.store(true);
+        wake();
+        worker.join();
+    }
+
+    Mailbox(const Mailbox&) = delete;
+    Mailbox& operator=(const Mailbox&) = delete;
+
+    // Queue a message without taking any lock on the fast path
+    // Fast path에서 lock 없이 메시지를 queue에 넣음
+    void post(const Message& message) {
+        push(Envelope{message, nullptr});
+    }
+
+    // Queue a whole batch as one slot; the worker hands it to updateBatch()
+    // Batch 전체를 slot 하나로 queue에 넣음; worker가 updateBatch()로 전달
+    void postBatch(const MessageBatch& batch) {
+        push(Envelope{Message(), batch});
+    }
+
+    // Wait until every accepted message has been delivered or dropped
+    // 수락된 모든 메시지가 전달되거나 버려질 때까지 대기
+    void flush() const {
+        while (completed.load(std::memory_order_acquire) + evicted.load(std::memory_order_acquire)
+               < enqueued.load(std::memory_order_acquire)) {
+            std::this_thread::yield();
+        }
+    }
+
+    const std::shared_ptr<Subscriber>& subscriber() const {
+        return target;
+    }
+
+    // Number of messages discarded by the backpressure policy
+    // Backpressure policy에 의해 버려진 메시지 수
+    std::uint64_t dropped() const {
+        return droppedMessages.load(std::memory_order_relaxed);
+    }
+
+private:
+    // One queue slot: a single message, or a batch when batch is set
+    // Queue slot 하나: 단일 메시지, 또는 batch가 설정된 경우 batch
+    struct Envelope {
+        Message message;
+        MessageBatch batch;
+
+        std::size_t count() const {
+            return batch ? batch->size() : 1;
+        }
+    };
+
+    std::shared_ptr<Subscriber> target;
+    RingBuffer<Envelope> queue; // Holds references, not copies of the payload
+                                // Payload 복사본이 아니라 참조를 보관
+    Backpressure backpressure;
+
+    std::atomic<std::uint64_t> enqueued{0};   // Slots accepted into the queue
+                                              // Queue에 수락된 slot
+    std::atomic<std::uint64_t> completed{0};  // Slots delivered by the worker
+                                              // Worker가 전달한 slot
+    std::atomic<std::uint64_t> evicted{0};    // Slots removed by DropOldest
+                                              // DropOldest로 제거된 slot
+    std::atomic<std::uint64_t> droppedMessages{0}; // Messages lost to backpressure
+                                                   // Backpressure로 잃은 메시지
+
+    std::atomic<bool> stopping{false};
+    std::atomic<bool> sleeping{false};
+    std::mutex sleepMutex;
+    std::condition_variable wakeUp;
+    std::thread worker;
+
+    void push(const Envelope& envelope) {
+        if (!queue.try_push(envelope)) {
+            switch (backpressure) {
+            case Backpressure::Block:
+                // A full queue means the worker is awake and draining it
+                // Queue가 가득 찼다면 worker는 깨어 있고 queue를 비우는 중
+                while (!queue.try_push(envelope)) {
+                    std::this_thread::yield();
+                }
+                break;
+            case Backpressure::DropOldest: {
+                Envelope oldest;
+                while (!queue.try_push(envelope)) {
+                    if (queue.try_pop(oldest)) {
+                        droppedMessages.fetch_add(oldest.count(), std::memory_order_relaxed);
+                        evicted.fetch_add(1, std::memory_order_relaxed);
+                    }
+                }
+                break;
+            }
+            case Backpressure::DropNewest:
+                droppedMessages.fetch_add(envelope.count(), std::memory_order_relaxed);
+                return;
+            }
+        }
+        // The seq_cst increment pairs with the worker's seq_cst store to
+        // sleeping, so either the worker sees this message or we see it asleep
+        // seq_cst 증가는 worker의 sleeping seq_cst store와 짝을 이루므로,
+        // worker가 이 메시지를 보거나 우리가 잠든 worker를 보게 됨
+        enqueued.fetch_add(1);
+
+        // Only touch the mutex when the worker has gone to sleep
+        // Worker가 잠들었을 때만 mutex를 사용
+        if (sleeping.load()) {
+            wake();
+        }
+    }
+
+    void wake() {
+        { std::lock_guard<std::mutex> lock(sleepMutex); }
+        wakeUp.notify_one();
+    }
+
+    void run() {
+        Envelope envelope;
+        while (true) {
+            bool stop = stopping.load();
+            std::uint64_t observed = enqueued.load();
+            if (queue.try_pop(envelope)) {
+                if (envelope.batch) {
+                    target->updateBatch(*envelope.batch);
+                } else {
+                    target->update(envelope.message);
+                }
+                envelope = Envelope(); // Drop our references before waiting for the next one
+                                       // 다음 slot을 기다리기 전에 참조를 해제
+                completed.fetch_add(1, std::memory_order_release);
+                continue;
+            }
+            if (stop) {
+                return; // Queue is empty and no more messages will arrive
+                        // Queue가 비었고 더 이상 메시지가 오지 않음
+            }
+
+            // Sleep until a message is enqueued after the failed pop
+            // Pop 실패 이후 메시지가 들어올 때까지 잠듦
+            std::unique_lock<std::mutex> lock(sleepMutex);
+            sleeping.store(true);
+            wakeUp.wait(lock, [this, observed]() {
+                return stopping.load() || enqueued.load() != observed;
+            });
+            sleeping.store(false);
+        }
+    }
+};
+
+// Publisher class that manages subscribers
+// Subscriber들을 관리하는 Publisher class
+//
+// Subscriptions are routed by topic: notify(topic, message) only visits the
+// subscribers whose pattern matches the topic (see TopicIndex).
+// Subscription은 topic으로 routing됨: notify(topic, message)는 pattern이 topic과
+// 일치하는 subscriber만 방문함 (TopicIndex 참고).
+//
+// A subscriber is either a shared_ptr<Subscriber> with a virtual update() or a
+// callable kept in place as a SubscriberCallback.
+// Subscriber는 virtual update()를 가진 shared_ptr<Subscriber>이거나, SubscriberCallback으로
+// 직접 보관되는 callable임.
+//
+// The subscriber list is an immutable snapshot replaced copy-on-write by
+// subscribe()/unsubscribe(). notify() reads the current snapshot without any
+// lock: it only registers itself in a per-epoch reader counter. Replaced
+// snapshots are retired and freed once no reader from their epoch remains
+// (epoch-based reclamation), so writers never wait for readers either.
+// Subscriber 목록은 subscribe()/unsubscribe()가 copy-on-write로 교체하는 불변
+// snapshot임. notify()는 lock 없이 현재 snapshot을 읽으며, epoch별 reader counter에
+// 자신을 등록하기만 함. 교체된 snapshot은 retire되었다가 해당 epoch의 reader가 모두
+// 끝나면 해제되므로 (epoch-based reclamation), writer도 reader를 기다리지 않음.
+class Publisher {
+private:
+    // Home of one lambda subscriber; slots live in fixed chunks and never move
+    // Lambda subscriber 하나의 자리; slot은 고정된 chunk에 있으며 이동하지 않음
+    //
+    // The slot starts on a cache line, so the callback, which is all that
+    // notify() reads, fills exactly the first line. The bookkeeping used by
+    // subscribe() and unsubscribe() sits on the second line.
+    // Slot은 cache line 경계에서 시작하므로, notify()가 읽는 유일한 부분인 callback이 정확히
+    // 첫 line을 채움. subscribe()와 unsubscribe()가 쓰는 관리 정보는 두 번째 line에 있음.
+    struct alignas(64) CallbackSlot {
+        SubscriberCallback callback;
+        std::uint64_t id = 0;
+        std::shared_ptr<Subscriber> adapter; // Mailbox target in asynchronous mode
+                                             // 비동기 mode에서 mailbox 대상
+        CallbackSlot* nextFree = nullptr;
+    };
+    static_assert(sizeof(CallbackSlot) == 128, "CallbackSlot should be two cache lines");
+
+    // One subscription: a subscriber or a callback slot and, in asynchronous mode, its mailbox
+    // Subscription 하나: subscriber 또는 callback slot과 (비동기 mode에서) 그 mailbox
+    struct Route {
+        std::shared_ptr<Subscriber> subscriber;
+        std::shared_ptr<Mailbox> mailbox;
+        CallbackSlot* slot = nullptr;
+    };
+
+    // One immutable version of the subscriber list
+    // Subscriber 목록의 불변 version 하나
+    struct Snapshot {
+        // Subscriptions indexed by topic pattern
+        // Topic pattern으로 index된 subscription
+        TopicIndex<Route> routes;
+
+        // One mailbox per subscriber in asynchronous mode, shared by all of
+        // its subscriptions so update() never runs on two threads at once
+        // 비동기 mode에서 subscriber마다 하나의 mailbox; 그 subscriber의 모든
+        // subscription이 공유하므로 update()가 두 thread에서 동시에 실행되지 않음
+        std::vector<std::shared_ptr<Mailbox>> mailboxes;
+    };
+
+    // Reader counters for the two live epoch parities, one cache line per shard
+    // 두 개의 활성 epoch parity에 대한 reader counter, shard마다 cache line 하나
+    static constexpr std::size_t kReaderShards = 16;
+    struct alignas(64) ReaderShard {
+        std::atomic<long> count[2] = {};
+    };
+
+    // Marks notify() and other readers as active for the current epoch
+    // notify()와 다른 reader가 현재 epoch에서 활성 상태임을 표시
+    class ReadSection {
+    public:
+        explicit ReadSection(const Publisher& publisher) {
+            ReaderShard& shard = publisher.readers[shardIndex()];
+            while (true) {
+                std::uint64_t e = publisher.epoch.load();
+                counter = &shard.count[e & 1];
+                counter->fetch_add(1);
+                // Retry if a writer advanced the epoch before we were counted
+                // 우리가 집계되기 전에 writer가 epoch를 진행시켰다면 재시도
+                if (publisher.epoch.load() == e) {
+                    break;
+                }
+                counter->fetch_sub(1);
+            }
+        }
+
+        ~ReadSection() {
+            counter->fetch_sub(1, std::memory_order_release);
+        }
+
+        ReadSection(const ReadSection&) = delete;
+        ReadSection& operator=(const ReadSection&) = delete;
+
+    private:
+        std::atomic<long>* counter;
+    };
+
+    std::atomic<const Snapshot*> current;
+    std::atomic<std::uint64_t> epoch{0};
+    mutable ReaderShard readers[kReaderShards];
+
+    // Serializes writers only; notify() never touches it
+    // Writer끼리만 직렬화; notify()는 사용하지 않음
+    std::mutex writerMutex;
+    std::vector<std::pair<const Snapshot*, std::uint64_t>> retired;
+
+    // Callback slots, allocated a chunk at a time; a slot freed by unsubscribe()
+    // is retired like a snapshot, since a reader may still be calling it
+    // Callback slot, chunk 단위로 할당됨; unsubscribe()가 해제한 slot은 reader가 아직
+    // 호출 중일 수 있으므로 snapshot처럼 retire됨
+    static constexpr std::size_t kSlotsPerChunk = 64;
+    std::vector<std::unique_ptr<CallbackSlot[]>> slotChunks;
+    CallbackSlot* freeSlots = nullptr;
+    std::vector<std::pair<CallbackSlot*, std::uint64_t>> retiredSlots;
+    std::uint64_t nextSubscriptionId = 1;
+
+    const DispatchMode mode;
+    const std::size_t queueCapacity;
+    const Backpressure backpressure;
+
+    static std::size_t shardIndex() {
+        static std::atomic<std::size_t> nextIndex{0};
+        thread_local std::size_t index =
+            nextIndex.fetch_add(1, std::memory_order_relaxed) % kReaderShards;
+        return index;
+    }
+
+    long activeReaders(std::uint64_t parity) const {
+        long total = 0;
+        for (const ReaderShard& shard : readers) {
+            total += shard.count[parity].load(std::memory_order_acquire);
+        }
+        return total;
+    }
+
+    // Swap in a new snapshot and free the ones no reader can still see
+    // 새 snapshot으로 교체하고 더 이상 reader가 볼 수 없는 snapshot을 해제
+    void publish(const Snapshot* next) {
+        const Snapshot* old = current.exchange(next);
+        retired.emplace_back(old, epoch.load());
+
+        // Epoch e may become e + 1 once no reader from e - 1 is left
+        // e - 1의 reader가 남아 있지 않으면 epoch e를 e + 1로 진행할 수 있음
+        for (int step = 0; step < 2; ++step) {
+            std::uint64_t e = epoch.load();
+            if (activeReaders((e + 1) & 1) != 0) {
+                break;
+            }
+            epoch.store(e + 1);
+        }
+
+        // A snapshot retired in epoch r is unreachable once the epoch reaches r + 2
+        // Epoch r에서 retire된 snapshot은 epoch가 r + 2에 도달하면 접근 불가능
+        std::uint64_t e = epoch.load();
+        auto it = retired.begin();
+        while (it != retired.end()) {
+            if (it->second + 2 <= e) {
+                delete it->first;
+                it = retired.erase(it);
+            } else {
+                ++it;
+            }
+        }
+
+        // After the snapshots, whose mailboxes may still deliver to these slots
+        // Slot에 아직 전달할 수 있는 mailbox를 가진 snapshot 다음에 해제
+        auto slot = retiredSlots.begin();
+        while (slot != retiredSlots.end()) {
+            if (slot->second + 2 <= e) {
+                releaseSlot(slot->first);
+                slot = retiredSlots.erase(slot);
+            } else {
+                ++slot;
+            }
+        }
+    }
+
+    CallbackSlot* acquireSlot() {
+        if (freeSlots == nullptr) {
+            slotChunks.push_back(std::make_unique<CallbackSlot[]>(kSlotsPerChunk));
+            CallbackSlot* chunk = slotChunks.back().get();
+            for (std::size_t i = kSlotsPerChunk; i > 0; --i) {
+                chunk[i - 1].nextFree = freeSlots;
+                freeSlots = &chunk[i - 1];
+            }
+        }
+        CallbackSlot* slot = freeSlots;
+        freeSlots = slot->nextFree;
+        return slot;
+    }
+
+    void releaseSlot(CallbackSlot* slot) {
+        slot->callback = nullptr;
+        slot->adapter.reset();
+        slot->nextFree = freeSlots;
+        freeSlots = slot;
+    }
+
+    static auto isRouteOf(const std::shared_ptr<Subscriber>& sub) {
+        return [&sub](const Route& route) { return route.slot == nullptr && route.subscriber == sub; };
+    }
+
+    // Existing mailbox of sub in snapshot, or a new one added to it
+    // snapshot에 있는 sub의 mailbox, 없으면 새로 만들어 추가
+    std::shared_ptr<Mailbox> mailboxFor(Snapshot& snapshot, const std::shared_ptr<Subscriber>& sub) {
+        for (const auto& mailbox : snapshot.mailboxes) {
+            if (mailbox->subscriber() == sub) {
+                return mailbox;
+            }
+        }
+        snapshot.mailboxes.push_back(std::make_shared<Mailbox>(sub, queueCapacity, backpressure));
+        return snapshot.mailboxes.back();
+    }
+
+    static void dropMailbox(Snapshot& snapshot, const std::shared_ptr<Subscriber>& sub) {
+        auto& boxes = snapshot.mailboxes;
+        boxes.erase(std::remove_if(boxes.begin(), boxes.end(),
+                                   [&sub](const std::shared_ptr<Mailbox>& mailbox) {
+                                       return mailbox->subscriber() == sub;
+                                   }),
+                    boxes.end());
+    }
+
+public:
+    explicit Publisher(DispatchMode dispatchMode = DispatchMode::Synchronous,
+                       std::size_t capacity = 1024,
+                       Backpressure policy = Backpressure::Block)
+        : current(new Snapshot), mode(dispatchMode), queueCapacity(capacity), backpressure(policy) {}
+
+    ~Publisher() {
+        delete current.load();
+        for (const auto& entry : retired) {
+            delete entry.first;
+        }
+    }
+
+    Publisher(const Publisher&) = delete;
+    Publisher& operator=(const Publisher&) = delete;
+
+    // Subscribe a new subscriber to every topic (same as the "*" pattern)
+    // 새로운 subscriber를 모든 topic에 등록 ("*" pattern과 동일)
+    void subscribe(const std::shared_ptr<Subscriber>& sub) {
+        subscribe("*", sub);
+    }
+
+    // Subscribe to a topic pattern: "a.b", "a.*" or "*"
+    // (safe to call while other threads notify)
+    // Topic pattern에 등록: "a.b", "a.*" 또는 "*"
+    // (다른 thread가 notify하는 중에도 안전)
+    void subscribe(std::string_view pattern, const std::shared_ptr<Subscriber>& sub) {
+        std::lock_guard<std::mutex> lock(writerMutex);
+        Snapshot* next = new Snapshot(*current.load());
+        Route route{sub, nullptr};
+        if (mode == DispatchMode::Asynchronous) {
+            route.mailbox = mailboxFor(*next, sub);
+        }
+        next->routes.add(pattern, route);
+        publish(next);
+    }
+
+    // Subscribe a lambda (or any callable taking const Message&) to every topic
+    // Lambda (또는 const Message&를 받는 모든 callable)를 모든 topic에 등록
+    SubscriptionId subscribe(SubscriberCallback callback) {
+        return subscribe("*", std::move(callback));
+    }
+
+    // Subscribe a callable to a topic pattern; it is stored in place in a
+    // publisher-owned slot, so no shared_ptr or per-subscriber allocation is
+    // needed, and it is called directly instead of through a virtual update()
+    // Callable을 topic pattern에 등록; publisher가 소유한 slot에 직접 저장되므로
+    // shared_ptr나 subscriber별 할당이 필요 없으며, virtual update() 대신 직접 호출됨
+    SubscriptionId subscribe(std::string_view pattern, SubscriberCallback callback) {
+        std::lock_guard<std::mutex> lock(writerMutex);
+        CallbackSlot* slot = acquireSlot();
+        slot->callback = std::move(callback);
+        slot->id = nextSubscriptionId++;
+        Snapshot* next = new Snapshot(*current.load());
+        Route route{nullptr, nullptr, slot};
+        if (mode == DispatchMode::Asynchronous) {
+            slot->adapter = std::make_shared<CallbackSubscriber>(slot->callback);
+            route.mailbox = mailboxFor(*next, slot->adapter);
+        }
+        next->routes.add(pattern, route);
+        publish(next);
+        return SubscriptionId{slot->id};
+    }
+
+    // Remove a callback subscription; returns false if it did not exist
+    // Callback subscription을 제거; 존재하지 않았다면 false 반환
+    bool unsubscribe(SubscriptionId id) {
+        std::lock_guard<std::mutex> lock(writerMutex);
+        Snapshot* next = new Snapshot(*current.load());
+        CallbackSlot* slot = nullptr;
+        auto isSlot = [id, &slot](const Route& route) {
+            if (route.slot != nullptr && route.slot->id == id.value) {
+                slot = route.slot;
+                return true;
+            }
+            return false;
+        };
+        if (next->routes.removeAll(isSlot) == 0) {
+            delete next;
+            return false;
+        }
+        if (slot->adapter) {
+            dropMailbox(*next, slot->adapter);
+        }
+        publish(next);
+        retiredSlots.emplace_back(slot, epoch.load());
+        return true;
+    }
+
+    // Remove every subscription of a subscriber; returns false if it had none
+    // Subscriber의 모든 subscription 제거; 하나도 없었다면 false 반환
+    //
+    // In-flight notify() calls may still deliver to it. In asynchronous mode its
+    // mailbox is drained before it is destroyed, so a subscriber must not
+    // unsubscribe itself from inside its own update().
+    // 진행 중인 notify() 호출은 여전히 전달할 수 있음. 비동기 mode에서는 mailbox가
+    // 소멸 전에 비워지므로, subscriber가 자신의 update() 안에서 스스로를
+    // unsubscribe해서는 안 됨.
+    bool unsubscribe(const std::shared_ptr<Subscriber>& sub) {
+        std::lock_guard<std::mutex> lock(writerMutex);
+        Snapshot* next = new Snapshot(*current.load());
+        if (next->routes.removeAll(isRouteOf(sub)) == 0) {
+            delete next;
+            return false;
+        }
+        dropMailbox(*next, sub);
+        publish(next);
+        return true;
+    }
+
+    // Remove one subscription; returns false if it did not exist
+    // Subscription 하나를 제거; 존재하지 않았다면 false 반환
+    bool unsubscribe(std::string_view pattern, const std::shared_ptr<Subscriber>& sub) {
+        std::lock_guard<std::mutex> lock(writerMutex);
+        Snapshot* next = new Snapshot(*current.load());
+        if (next->routes.remove(pattern, isRouteOf(sub)) == 0) {
+            delete next;
+            return false;
+        }
+        if (!next->routes.any(isRouteOf(sub))) {
+            dropMailbox(*next, sub);
+        }
+        publish(next);
+        return true;
+    }
+
+    // Notify subscribers of "*" (and those subscribed without a topic)
+    // "*" subscriber (그리고 topic 없이 등록한 subscriber)에게 알림
+    void notify(std::string_view text) {
+        notify(Message(text)); // One pooled allocation shared by every subscriber
+                               // 모든 subscriber가 공유하는 한 번의 pool 할당
+    }
+
+    void notify(const Message& message) {
+        notify(std::string_view(), message);
+    }
+
+    // Notify the subscribers whose pattern matches topic
+    // Pattern이 topic과 일치하는 subscriber에게 알림
+    void notify(std::string_view topic, std::string_view text) {
+        notify(topic, Message(text));
+    }
+
+    // Notify with an already built message (lock-free)
+    // 이미 만들어진 메시지로 알림 (lock-free)
+    void notify(std::string_view topic, const Message& message) {
+        INSTRUMENT_SCOPE("Publisher::notify");
+        ReadSection section(*this);
+        const Snapshot* snapshot = current.load();
+        std::size_t delivered = 0;
+        if (mode == DispatchMode::Synchronous) {
+            snapshot->routes.forEachMatch(topic, [&message, &delivered](const Route& route) {
+                if (route.slot != nullptr) {
+                    route.slot->callback(message);
+                } else {
+                    route.subscriber->update(message);
+                }
+                ++delivered;
+            });
+        } else {
+            snapshot->routes.forEachMatch(topic, [&message, &delivered](const Route& route) {
+                route.mailbox->post(message);
+                ++delivered;
+            });
+        }
+        INSTRUMENT_COUNT("Publisher::deliveries", delivered);
+    }
+
+    // Notify "*" subscribers with several messages at once
+    // 여러 메시지로 "*" subscriber에게 한 번에 알림
+    void notifyBatch(std::span<const Message> messages) {
+        notifyBatch(std::string_view(), messages);
+    }
+
+    // Notify matching subscribers with several messages at once
+    // 일치하는 subscriber에게 여러 메시지로 한 번에 알림
+    //
+    // Each subscriber costs one updateBatch() call, or one queue slot in
+    // asynchronous mode, per batch instead of per message.
+    // 각 subscriber에 대한 비용이 메시지마다가 아니라 batch마다 updateBatch() 호출
+    // 한 번 (비동기 mode에서는 queue slot 하나)임.
+    void notifyBatch(std::string_view topic, std::span<const Message> messages) {
+        if (messages.empty()) {
+            return;
+        }
+        ReadSection section(*this);
+        const Snapshot* snapshot = current.load();
+        if (mode == DispatchMode::Synchronous) {
+            snapshot->routes.forEachMatch(topic, [messages](const Route& route) {
+                if (route.slot != nullptr) {
+                    for (const Message& message : messages) {
+                        route.slot->callback(message);
+                    }
+                } else {
+                    route.subscriber->updateBatch(messages);
+                }
+            });
+        } else {
+            // Copying the Message handles is cheap; every mailbox shares the batch
+            // Message handle 복사는 저렴하며, 모든 mailbox가 batch를 공유
+            MessageBatch batch;
+            snapshot->routes.forEachMatch(topic, [&](const Route& route) {
+                if (!batch) {
+                    batch = std::make_shared<const std::vector<Message>>(messages.begin(), messages.end());
+                }
+                route.mailbox->postBatch(batch);
+            });
+        }
+    }
+
+    // Wait until every queued message has been handled (asynchronous mode)
+    // Queue에 들어간 모든 메시지가 처리될 때까지 대기 (비동기 mode)
+    void flush() const {
+        ReadSection section(*this);
+        for (const auto& mailbox : current.load()->mailboxes) {
+            mailbox->flush();
+        }
+    }
+
+    // Total messages dropped by backpressure across all subscribers
+    // 모든 subscriber에서 backpressure로 버려진 메시지 총 수
+    std::uint64_t dropped() const {
+        ReadSection section(*this);
+        std::uint64_t total = 0;
+        for (const auto& mailbox : current.load()->mailboxes) {
+            total += mailbox->dropped();
+        }
+        return total;
+    }
+
+    // Number of subscriptions in the current snapshot
+    // 현재 snapshot의 subscription 수
+    std::size_t size() const {
+        ReadSection section(*this);
+        return current.load()->routes.size();
+    }
+};
+
+#endif // EX82_PUBSUB_H
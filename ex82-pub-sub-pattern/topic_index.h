@@ -0,0 +1,342 @@
+#ifndef EX82_TOPIC_INDEX_H
+#define EX82_TOPIC_INDEX_H
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// Hash that accepts std::string_view, so lookups don't build a std::string
+// std::string_view를 받는 hash, lookup 시 std::string을 만들지 않음
+struct TopicHash {
+    using is_transparent = void;
+
+    std::size_t operator()(std::string_view topic) const {
+        return std::hash<std::string_view>{}(topic);
+    }
+};
+
+template<typename Value>
+using TopicMap = std::unordered_map<std::string, Value, TopicHash, std::equal_to<>>;
+
+// Routing index from topic patterns to entries
+// Topic pattern에서 entry로의 routing index
+//
+// Topics are dot-separated ("sensor.kitchen.temp"). A pattern is either an
+// exact topic, a prefix wildcard ("sensor.*" matches every topic below
+// "sensor") or "*" (matches every topic). Exact patterns live in a hash map
+// and wildcards in a trie of segments, so finding the matches for a topic
+// costs one hash lookup plus one trie step per segment, independent of how
+// many entries are stored.
+// Topic은 점으로 구분됨 ("sensor.kitchen.temp"). Pattern은 정확한 topic, prefix
+// wildcard ("sensor.*"는 "sensor" 아래의 모든 topic과 일치), 또는 "*" (모든 topic과
+// 일치) 중 하나임. 정확한 pattern은 hash map에, wildcard는 segment trie에 저장되므로,
+// 한 topic에 일치하는 항목을 찾는 비용은 hash lookup 한 번과 segment마다 trie 한 단계이며
+// 저장된 entry 수와 무관함.
+//
+// The exact-topic map, entry lists and trie nodes are immutable and shared
+// between copies, so copying an index copies three pointers. A wildcard
+// change replaces only the trie nodes on its path and one entry list. An
+// exact change must copy the whole map, which costs O(exact topics), but it
+// shares every entry list except the one it changes. That is the cost of
+// each copy-on-write subscribe or unsubscribe in the publisher.
+// Exact topic map, entry 목록, trie node는 불변이며 복사본 사이에서 공유되므로, index
+// 복사는 pointer 세 개를 복사함. Wildcard 변경은 경로의 trie node와 entry 목록 하나만
+// 교체함. Exact 변경은 map 전체를 복사해야 하므로 O(exact topic 수)의 비용이 들지만,
+// 바뀌는 목록을 제외한 모든 entry 목록은 공유함. 이것이 publisher에서 copy-on-write
+// subscribe 또는 unsubscribe 한 번의 비용임.
+template<typename Entry>
+class TopicIndex {
+public:
+    // Add an entry under a pattern
+    // Pattern 아래에 entry 추가
+    void add(std::string_view pattern, const Entry& entry) {
+        std::string_view prefix;
+        if (wildcardPrefix(pattern, prefix)) {
+            root = addWildcard(root.get(), prefix, entry);
+        } else {
+            auto copy = std::make_shared<ExactMap>(*exact);
+            auto found = copy->find(pattern);
+            List current = (found == copy->end()) ? List() : found->second;
+            (*copy)[std::string(pattern)] = appended(current, entry);
+            exact = std::move(copy);
+        }
+        ++count;
+    }
+
+    // Remove the entries under one pattern for which matches(entry) is true
+    // 한 pattern 아래에서 matches(entry)가 true인 entry를 제거
+    template<typename Pred>
+    std::size_t remove(std::string_view pattern, Pred matches) {
+        std::size_t removed = 0;
+        std::string_view prefix;
+        if (wildcardPrefix(pattern, prefix)) {
+            root = removeWildcard(root, prefix, matches, removed);
+        } else {
+            auto found = exact->find(pattern);
+            if (found != exact->end()) {
+                List kept = filtered(found->second, matches, removed);
+                if (kept != found->second) {
+                    auto copy = std::make_shared<ExactMap>(*exact);
+                    if (kept) {
+                        (*copy)[found->first] = kept;
+                    } else {
+                        copy->erase(found->first);
+                    }
+                    exact = std::move(copy);
+                }
+            }
+        }
+        count -= removed;
+        return removed;
+    }
+
+    // Remove the matching entries under every pattern
+    // 모든 pattern 아래에서 일치하는 entry를 제거
+    template<typename Pred>
+    std::size_t removeAll(Pred matches) {
+        std::size_t removed = 0;
+        if (anyExact(matches)) {
+            auto copy = std::make_shared<ExactMap>(*exact);
+            for (auto it = copy->begin(); it != copy->end();) {
+                List kept = filtered(it->second, matches, removed);
+                if (kept) {
+                    it->second = kept;
+                    ++it;
+                } else {
+                    it = copy->erase(it);
+                }
+            }
+            exact = std::move(copy);
+        }
+        root = removeWildcardEverywhere(root, matches, removed);
+        count -= removed;
+        return removed;
+    }
+
+    // Call visit(entry) once for every pattern entry that matches topic
+    // Topic과 일치하는 pattern의 모든 entry에 대해 visit(entry)를 한 번씩 호출
+    template<typename Visitor>
+    void forEachMatch(std::string_view topic, Visitor&& visit) const {
+        auto found = exact->find(topic);
+        if (found != exact->end()) {
+            for (const Entry& entry : *found->second) {
+                visit(entry);
+            }
+        }
+
+        // "*" matches every topic; "a.b.*" needs at least one segment after "a.b"
+        // "*"는 모든 topic과 일치; "a.b.*"는 "a.b" 뒤에 segment가 하나 이상 필요
+        const Node* node = root.get();
+        if (node != nullptr && node->entries) {
+            for (const Entry& entry : *node->entries) {
+                visit(entry);
+            }
+        }
+        std::string_view rest = topic;
+        while (node != nullptr && !rest.empty()) {
+            std::string_view head = splitHead(rest);
+            auto child = node->children.find(head);
+            if (child == node->children.end()) {
+                break;
+            }
+            node = child->second.get();
+            if (!rest.empty() && node->entries) {
+                for (const Entry& entry : *node->entries) {
+                    visit(entry);
+                }
+            }
+        }
+    }
+
+    // True if matches(entry) holds for any entry under any pattern
+    // 어느 pattern 아래든 matches(entry)를 만족하는 entry가 있으면 true
+    template<typename Pred>
+    bool any(Pred matches) const {
+        return anyExact(matches) || anyWildcard(root.get(), matches);
+    }
+
+    // Total number of (pattern, entry) pairs
+    // (pattern, entry) 쌍의 총 개수
+    std::size_t size() const {
+        return count;
+    }
+
+private:
+    using List = std::shared_ptr<const std::vector<Entry>>;
+
+    // Trie node for the wildcard patterns that share a prefix
+    // 같은 prefix를 공유하는 wildcard pattern을 위한 trie node
+    struct Node {
+        TopicMap<std::shared_ptr<const Node>> children;
+        List entries; // Entries subscribed to "<path to this node>.*"
+                      // "<이 node까지의 경로>.*"에 등록된 entry
+    };
+    using NodePtr = std::shared_ptr<const Node>;
+    using ExactMap = TopicMap<List>;
+
+    std::shared_ptr<const ExactMap> exact = std::make_shared<const ExactMap>();
+    NodePtr root;
+    std::size_t count = 0;
+
+    // "*" -> "", "a.b.*" -> "a.b"; false for exact patterns
+    // "*" -> "", "a.b.*" -> "a.b"; 정확한 pattern이면 false
+    static bool wildcardPrefix(std::string_view pattern, std::string_view& prefix) {
+        if (pattern == "*") {
+            prefix = std::string_view();
+            return true;
+        }
+        if (pattern.size() >= 2 && pattern.substr(pattern.size() - 2) == ".*") {
+            prefix = pattern.substr(0, pattern.size() - 2);
+            return true;
+        }
+        return false;
+    }
+
+    // Return the first segment of rest and advance rest past it
+    // rest의 첫 segment를 반환하고 rest를 그 다음으로 이동
+    static std::string_view splitHead(std::string_view& rest) {
+        std::size_t dot = rest.find('.');
+        std::string_view head = rest.substr(0, dot);
+        rest = (dot == std::string_view::npos) ? std::string_view() : rest.substr(dot + 1);
+        return head;
+    }
+
+    static List appended(const List& list, const Entry& entry) {
+        auto next = list ? std::make_shared<std::vector<Entry>>(*list)
+                         : std::make_shared<std::vector<Entry>>();
+        next->push_back(entry);
+        return next;
+    }
+
+    // Copy of list without the matching entries; null if nothing is left
+    // 일치하는 entry를 뺀 list 복사본; 남는 것이 없으면 null
+    template<typename Pred>
+    static List filtered(const List& list, Pred& matches, std::size_t& removed) {
+        if (!list) {
+            return list;
+        }
+        auto next = std::make_shared<std::vector<Entry>>();
+        for (const Entry& entry : *list) {
+            if (matches(entry)) {
+                ++removed;
+            } else {
+                next->push_back(entry);
+            }
+        }
+        if (next->size() == list->size()) {
+            return list; // Unchanged, keep sharing the old list
+                         // 변경 없음, 기존 list를 계속 공유
+        }
+        return next->empty() ? List() : List(std::move(next));
+    }
+
+    template<typename Pred>
+    bool anyExact(Pred& matches) const {
+        for (const auto& topic : *exact) {
+            for (const Entry& entry : *topic.second) {
+                if (matches(entry)) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    template<typename Pred>
+    static bool anyWildcard(const Node* node, Pred& matches) {
+        if (node == nullptr) {
+            return false;
+        }
+        if (node->entries) {
+            for (const Entry& entry : *node->entries) {
+                if (matches(entry)) {
+                    return true;
+                }
+            }
+        }
+        for (const auto& child : node->children) {
+            if (anyWildcard(child.second.get(), matches)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    static bool isEmpty(const Node& node) {
+        return !node.entries && node.children.empty();
+    }
+
+    // Copy the nodes along prefix and append entry at its end
+    // prefix 경로의 node를 복사하고 끝에 entry를 추가
+    static NodePtr addWildcard(const Node* node, std::string_view rest, const Entry& entry) {
+        auto copy = node ? std::make_shared<Node>(*node) : std::make_shared<Node>();
+        if (rest.empty()) {
+            copy->entries = appended(copy->entries, entry);
+        } else {
+            std::string_view head = splitHead(rest);
+            auto child = copy->children.find(head);
+            const Node* next = (child == copy->children.end()) ? nullptr : child->second.get();
+            copy->children[std::string(head)] = addWildcard(next, rest, entry);
+        }
+        return copy;
+    }
+
+    template<typename Pred>
+    static NodePtr removeWildcard(const NodePtr& node, std::string_view rest, Pred& matches,
+                                  std::size_t& removed) {
+        if (!node) {
+            return node;
+        }
+        auto copy = std::make_shared<Node>(*node);
+        std::size_t before = removed;
+        if (rest.empty()) {
+            copy->entries = filtered(copy->entries, matches, removed);
+        } else {
+            std::string_view head = splitHead(rest);
+            auto child = copy->children.find(head);
+            if (child == copy->children.end()) {
+                return node;
+            }
+            NodePtr next = removeWildcard(child->second, rest, matches, removed);
+            if (next) {
+                child->second = next;
+            } else {
+                copy->children.erase(child);
+            }
+        }
+        if (removed == before) {
+            return node;
+        }
+        return isEmpty(*copy) ? NodePtr() : NodePtr(std::move(copy));
+    }
+
+    template<typename Pred>
+    static NodePtr removeWildcardEverywhere(const NodePtr& node, Pred& matches, std::size_t& removed) {
+        if (!node) {
+            return node;
+        }
+        auto copy = std::make_shared<Node>(*node);
+        std::size_t before = removed;
+        copy->entries = filtered(copy->entries, matches, removed);
+        for (auto it = copy->children.begin(); it != copy->children.end();) {
+            NodePtr next = removeWildcardEverywhere(it->second, matches, removed);
+            if (next) {
+                it->second = next;
+                ++it;
+            } else {
+                it = copy->children.erase(it);
+            }
+        }
+        if (removed == before) {
+            return node;
+        }
+        return isEmpty(*copy) ? NodePtr() : NodePtr(std::move(copy));
+    }
+};
+
+#endif // EX82_TOPIC_INDEX_H
@@ -0,0 +1,112 @@
+#ifndef EX83_DEVICE_H
+#define EX83_DEVICE_H
+
+#include <iostream>
+#include <ostream>
+
+#include "instrument.h"
+
+// Forward declaration for Device class
+// Device class에 대한 forward declaration
+class Device;
+
+// State interface (abstract class)
+// State interface (추상 class)
+//
+// States carry no data, so each concrete state is a flyweight: one static
+// instance shared by every Device. A transition only swaps a pointer; it
+// allocates nothing and touches no reference count.
+// State는 data를 가지지 않으므로 각 구체적인 state는 flyweight임: 모든 Device가
+// 공유하는 하나의 static instance. Transition은 pointer만 교체하며, 할당이나
+// reference count 변경이 없음.
+class PowerState {
+public:
+    // Pure virtual function for handling power button press
+    // Power button 누름을 처리하는 순수 가상 함수
+    virtual void powerButton(Device& device) const = 0;
+    virtual ~PowerState() = default;
+};
+
+// Concrete state: Standby
+// 구체적인 state: Standby
+class StandbyState : public PowerState {
+public:
+    static const StandbyState instance; // Shared by every Device
+                                        // 모든 Device가 공유
+
+    void powerButton(Device& device) const override;
+};
+
+// Concrete state: On
+// 구체적인 state: On
+class OnState : public PowerState {
+public:
+    static const OnState instance; // Shared by every Device
+                                   // 모든 Device가 공유
+
+    void powerButton(Device& device) const override;
+};
+
+inline const StandbyState StandbyState::instance;
+inline const OnState OnState::instance;
+
+// Device class that manages its state
+// 상태를 관리하는 Device class
+class Device {
+private:
+    // Current state of the device, never null
+    // Device의 현재 상태, null이 아님
+    const PowerState* state;
+
+    // Where transitions are reported
+    // Transition이 출력되는 곳
+    std::ostream& out;
+
+public:
+    // Constructor initializes device in Standby state
+    // Constructor는 device를 Standby 상태로 초기화
+    explicit Device(std::ostream& log = std::cout) : state(&StandbyState::instance), out(log) {
+        out << "Device initialized in Standby\n";
+    }
+
+    // Method to change the device state
+    // Device 상태를 변경하는 method
+    void setState(const PowerState& newState) {
+        state = &newState;
+    }
+
+    // Method to handle power button press
+    // Power button 누름을 처리하는 method
+    void pressPowerButton() {
+        INSTRUMENT_SCOPE("Device::pressPowerButton");
+        state->powerButton(*this);
+    }
+
+    const PowerState& currentState() const {
+        return *state;
+    }
+
+    std::ostream& log() {
+        return out;
+    }
+};
+
+// Implementation of StandbyState::powerButton
+// StandbyState::powerButton의 구현
+inline void StandbyState::powerButton(Device& device) const {
+    device.log() << "Turning ON\n";
+    // Transition to On state
+    // On 상태로 전환
+    device.setState(OnState::instance);
+}
+
+// Implementation of OnState::powerButton
+// OnState::powerButton의 구현
+inline void OnState::powerButton(Device& device) const {
+    device.log() << "Turning OFF\n";
+    // Transition to Standby state
+    // Standby 상태로 전환
+    device.setState(StandbyState::instance);
+}
+
+#endif // EX83_DEVICE_H
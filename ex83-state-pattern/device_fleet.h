@@ -0,0 +1,186 @@
+#ifndef EX83_DEVICE_FLEET_H
+#define EX83_DEVICE_FLEET_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#if defined(__SSSE3__)
+#include <immintrin.h>
+#endif
+
+#include "state_table.h"
+
+// Many state machines sharing one TransitionTable, stored as an array of states
+// 하나의 TransitionTable을 공유하는 여러 state machine, state 배열로 저장
+//
+// Instead of one object per device, the fleet keeps every device's state in
+// one contiguous vector (struct-of-arrays) and applies an event to all of
+// them in a single pass. When no state has a guard or action for the event,
+// the pass is a pure lookup next[state]; with one-byte states and at most 16
+// states it runs as a SIMD byte shuffle, 16 (SSSE3) or 32 (AVX2) devices per
+// instruction. Other events fall back to a scalar loop over the table.
+// Device마다 객체 하나를 두는 대신 fleet은 모든 device의 state를 하나의 연속된
+// vector (struct-of-arrays)에 보관하고, event를 한 번의 순회로 전체에 적용함.
+// 어떤 state도 그 event에 guard나 action이 없으면 순회는 순수 lookup next[state]이며,
+// 1 byte state이고 state가 16개 이하이면 SIMD byte shuffle로 instruction마다 16개
+// (SSSE3) 또는 32개 (AVX2) device를 처리함. 그 외 event는 table을 사용하는 scalar
+// loop로 처리함.
+template<const auto& Table>
+class DeviceFleet {
+public:
+    using TableType = std::remove_reference_t<decltype(Table)>;
+    using State = typename TableType::State;
+    using Event = typename TableType::Event;
+    using Context = typename TableType::Context;
+
+    static constexpr std::size_t kNumStates = TableType::kNumStates;
+    static constexpr std::size_t kNumEvents = TableType::kNumEvents;
+
+    // Thin per-device handle into the fleet
+    // Fleet 안의 device 하나에 대한 얇은 handle
+    class View {
+    public:
+        View(DeviceFleet& owner, std::size_t index) : fleet(&owner), slot(index) {}
+
+        bool dispatch(Event event) {
+            return fleet->dispatchOne(slot, event);
+        }
+
+        State state() const {
+            return fleet->states[slot];
+        }
+
+    private:
+        DeviceFleet* fleet;
+        std::size_t slot;
+    };
+
+    DeviceFleet(std::size_t count, State initial, Context& ctx) : states(count, initial), context(&ctx) {}
+
+    std::size_t size() const {
+        return states.size();
+    }
+
+    View operator[](std::size_t index) {
+        return View(*this, index);
+    }
+
+    // Apply one event to every device
+    // 모든 device에 event 하나를 적용
+    void applyAll(Event event) {
+        if (pure[static_cast<std::size_t>(event)]) {
+            applyLookup(next[static_cast<std::size_t>(event)]);
+        } else {
+            for (std::size_t i = 0; i < states.size(); ++i) {
+                dispatchOne(i, event);
+            }
+        }
+    }
+
+    // Apply events[i] to device i, one event per device
+    // Device i에 events[i]를 적용, device마다 event 하나
+    void applyEach(const Event* events) {
+        for (std::size_t i = 0; i < states.size(); ++i) {
+            dispatchOne(i, events[i]);
+        }
+    }
+
+    // Number of devices currently in state
+    // 현재 state에 있는 device 수
+    std::size_t count(State state) const {
+        std::size_t n = 0;
+        for (State s : states) {
+            n += (s == state) ? 1 : 0;
+        }
+        return n;
+    }
+
+private:
+    using NextStates = std::array<State, kNumStates>;
+
+    std::vector<State> states; // One entry per device
+                               // Device마다 하나의 entry
+    Context* context;
+
+    // True if no state has a guard or action for the event
+    // 어떤 state도 그 event에 guard나 action이 없으면 true
+    static constexpr std::array<bool, kNumEvents> findPure() {
+        std::array<bool, kNumEvents> result{};
+        for (std::size_t e = 0; e < kNumEvents; ++e) {
+            result[e] = true;
+            for (std::size_t s = 0; s < kNumStates; ++s) {
+                const auto& cell = Table.at(static_cast<State>(s), static_cast<Event>(e));
+                if (cell.guard != nullptr || cell.action != nullptr) {
+                    result[e] = false;
+                }
+            }
+        }
+        return result;
+    }
+
+    // next[event][state]: the state after event, for the pure lookup pass
+    // next[event][state]: event 이후의 state, 순수 lookup 순회에 사용
+    static constexpr std::array<NextStates, kNumEvents> findNext() {
+        std::array<NextStates, kNumEvents> result{};
+        for (std::size_t e = 0; e < kNumEvents; ++e) {
+            for (std::size_t s = 0; s < kNumStates; ++s) {
+                result[e][s] = Table.at(static_cast<State>(s), static_cast<Event>(e)).to;
+            }
+        }
+        return result;
+    }
+
+    static constexpr std::array<bool, kNumEvents> pure = findPure();
+    static constexpr std::array<NextStates, kNumEvents> next = findNext();
+
+    // The byte shuffle needs one-byte states that fit in a 16-entry table
+    // Byte shuffle은 16개 항목 table에 들어가는 1 byte state가 필요함
+    static constexpr bool kShuffle = sizeof(State) == 1 && kNumStates <= 16;
+
+    bool dispatchOne(std::size_t index, Event event) {
+        const auto& cell = Table.at(states[index], event);
+        if (!cell.handled || (cell.guard != nullptr && !cell.guard(*context))) {
+            return false;
+        }
+        if (cell.action != nullptr) {
+            cell.action(*context);
+        }
+        states[index] = cell.to;
+        return true;
+    }
+
+    void applyLookup(const NextStates& lookup) {
+        std::size_t i = 0;
+#if defined(__SSSE3__)
+        if constexpr (kShuffle) {
+            alignas(16) std::uint8_t bytes[16] = {};
+            for (std::size_t s = 0; s < kNumStates; ++s) {
+                bytes[s] = static_cast<std::uint8_t>(lookup[s]);
+            }
+            std::uint8_t* data = reinterpret_cast<std::uint8_t*>(states.data());
+            const __m128i table16 = _mm_load_si128(reinterpret_cast<const __m128i*>(bytes));
+#if defined(__AVX2__)
+            // The 256-bit shuffle works per 128-bit lane, so both lanes get the table
+            // 256-bit shuffle은 128-bit lane 단위로 동작하므로 두 lane 모두에 table을 넣음
+            const __m256i table32 = _mm256_broadcastsi128_si256(table16);
+            for (; i + 32 <= states.size(); i += 32) {
+                __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(data + i), _mm256_shuffle_epi8(table32, v));
+            }
+#endif
+            for (; i + 16 <= states.size(); i += 16) {
+                __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(data + i), _mm_shuffle_epi8(table16, v));
+            }
+        }
+#endif
+        for (; i < states.size(); ++i) {
+            states[i] = lookup[static_cast<std::size_t>(states[i])];
+        }
+    }
+};
+
+#endif // EX83_DEVICE_FLEET_H
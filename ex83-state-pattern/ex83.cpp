@@ -1,91 +1,13 @@
 #include <iostream>
 #include <memory>
 
-// Forward declaration for Device class
-// Device class에 대한 forward declaration
-class Device;
+#include "device.h"
+#include "power_table.h"
 
-// Forward declarations for concrete state classes
-// 구체적인 state class들에 대한 forward declaration
-class StandbyState;
-class OnState;
+int main(int argc, char* argv[]) {
+    InstrumentTraceSession trace(argc, argv); // --trace=FILE records every button press
+                                              // --trace=FILE은 모든 button 누름을 기록
 
-// State interface (abstract class)
-// State interface (추상 class)
-class PowerState {
-public:
-    // Pure virtual function for handling power button press
-    // Power button 누름을 처리하는 순수 가상 함수
-    virtual void powerButton(Device& device) = 0;
-    virtual ~PowerState() = default;
-};
-
-// Device class that manages its state
-// 상태를 관리하는 Device class
-class Device {
-private:
-    // Current state of the device
-    // Device의 현재 상태
-    std::shared_ptr<PowerState> state;
-
-public:
-    // Constructor initializes device in Standby state
-    // Constructor는 device를 Standby 상태로 초기화
-    Device() {
-        state = std::static_pointer_cast<PowerState>(std::make_shared<StandbyState>());
-        std::cout << "Device initialized in Standby\n";
-    }
-
-    // Method to change the device state
-    // Device 상태를 변경하는 method
-    void setState(const std::shared_ptr<PowerState>& newState) {
-        state = newState;
-    }
-
-    // Method to handle power button press
-    // Power button 누름을 처리하는 method
-    void pressPowerButton() {
-        state->powerButton(*this);
-    }
-};
-
-// Concrete state: Standby
-// 구체적인 state: Standby
-class StandbyState : public PowerState {
-public:
-    // Declaration only - implementation below
-    // 선언만 - 구현은 아래에
-    void powerButton(Device& device) override;
-};
-
-// Concrete state: On
-// 구체적인 state: On
-class OnState : public PowerState {
-public:
-    // Declaration only - implementation below
-    // 선언만 - 구현은 아래에
-    void powerButton(Device& device) override;
-};
-
-// Implementation of StandbyState::powerButton
-// StandbyState::powerButton의 구현
-void StandbyState::powerButton(Device& device) {
-    std::cout << "Turning ON\n";
-    // Transition to On state
-    // On 상태로 전환
-    device.setState(std::static_pointer_cast<PowerState>(std::make_shared<OnState>()));
-}
-
-// Implementation of OnState::powerButton
-// OnState::powerButton의 구현
-void OnState::powerButton(Device& device) {
-    std::cout << "Turning OFF\n";
-    // Transition to Standby state
-    // Standby 상태로 전환
-    device.setState(std::static_pointer_cast<PowerState>(std::make_shared<StandbyState>()));
-}
-
-int main() {
     // Create a device instance
     // Device instance 생성
     auto device = std::make_shared<Device>();
@@ -96,5 +18,24 @@ int main() {
     device->pressPowerButton();  // On -> Standby
     device->pressPowerButton();  // Standby -> On
 
+    // The same device as a table-driven state machine
+    // 같은 device를 table 기반 state machine으로
+    PowerContext context;
+    PowerMachine machine(Power::Standby, context);
+    machine.dispatch(PowerEvent::Button);  // Standby -> On
+    machine.dispatch(PowerEvent::Button);  // On -> Standby
+    machine.dispatch(PowerEvent::Button);  // Standby -> On
+
+    // A fleet of devices stored as one array of states
+    // 하나의 state 배열로 저장된 device fleet
+    PowerContext fleetContext;
+    PowerFleet fleet(1000, Power::Standby, fleetContext);
+    FleetDevice first(fleet, 0);
+    first.pressPowerButton();                // Device 0 only
+                                             // Device 0만
+    fleet.applyAll(PowerEvent::Button);      // Every device in one pass
+                                             // 한 번의 순회로 모든 device
+    std::cout << "Fleet: " << fleet.count(Power::On) << " of " << fleet.size() << " devices on\n";
+
     return 0;
-}
\ No newline at end of file
+}
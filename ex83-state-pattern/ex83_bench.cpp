@@ -0,0 +1,403 @@
+#include <array>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <ostream>
+#include <random>
+#include <string>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+#include "benchmark.h"
+#include "device.h"
+#include "power_table.h"
+#include "state_table.h"
+
+// The original engine: a new shared_ptr state per transition
+// 기존 engine: transition마다 새로운 shared_ptr state
+namespace legacy {
+
+class Device;
+
+class PowerState {
+public:
+    virtual void powerButton(Device& device) = 0;
+    virtual ~PowerState() = default;
+};
+
+class Device {
+private:
+    std::shared_ptr<PowerState> state;
+    std::ostream& out;
+
+public:
+    explicit Device(std::ostream& log);
+
+    void setState(const std::shared_ptr<PowerState>& newState) {
+        state = newState;
+    }
+
+    void pressPowerButton() {
+        state->powerButton(*this);
+    }
+
+    std::ostream& log() {
+        return out;
+    }
+};
+
+class StandbyState : public PowerState {
+public:
+    void powerButton(Device& device) override;
+};
+
+class OnState : public PowerState {
+public:
+    void powerButton(Device& device) override;
+};
+
+Device::Device(std::ostream& log) : state(std::make_shared<StandbyState>()), out(log) {
+    out << "Device initialized in Standby\n";
+}
+
+void StandbyState::powerButton(Device& device) {
+    device.log() << "Turning ON\n";
+    device.setState(std::static_pointer_cast<PowerState>(std::make_shared<OnState>()));
+}
+
+void OnState::powerButton(Device& device) {
+    device.log() << "Turning OFF\n";
+    device.setState(std::static_pointer_cast<PowerState>(std::make_shared<StandbyState>()));
+}
+
+} // namespace legacy
+
+// Larger machine for the dispatch benchmark: 50 states, 20 events
+// Dispatch 벤치마크용 큰 machine: 50개 state, 20개 event
+//
+// The same transitions are built once as a TransitionTable and once as one
+// class per state with a virtual handler, as they would be written by hand.
+// 같은 transition을 한 번은 TransitionTable로, 한 번은 직접 작성하듯 state마다 virtual
+// handler를 가진 class로 만듦.
+constexpr int kBigStates = 50;
+constexpr int kBigEvents = 20;
+constexpr std::size_t kEventStream = 1 << 22;
+
+enum class BigState : std::uint8_t {};
+enum class BigEvent : std::uint8_t {};
+
+struct BigContext {
+    unsigned long count = 0;
+    unsigned long sum = 0;
+};
+
+bool evenCount(const BigContext& context) {
+    return (context.count & 1) == 0;
+}
+
+void countStep(BigContext& context) {
+    ++context.count;
+}
+
+void addStep(BigContext& context) {
+    context.sum += context.count;
+}
+
+// A quarter of the (state, event) pairs are ignored, every fifth event has a
+// guard, and the action alternates between two functions
+// (state, event) 쌍의 1/4은 무시되고, 다섯 번째 event마다 guard가 있으며, action은
+// 두 함수를 번갈아 사용함
+constexpr bool bigHandled(int state, int event) {
+    return (state + event) % 4 != 0;
+}
+
+constexpr int bigTarget(int state, int event) {
+    return (state * 7 + event * 13 + 1) % kBigStates;
+}
+
+constexpr bool bigGuarded(int event) {
+    return event % 5 == 0;
+}
+
+constexpr bool bigCounts(int event) {
+    return event % 2 == 0;
+}
+
+using BigTable = TransitionTable<BigState, BigEvent, BigContext, kBigStates, kBigEvents>;
+
+constexpr int countBigRows() {
+    int rows = 0;
+    for (int s = 0; s < kBigStates; ++s) {
+        for (int e = 0; e < kBigEvents; ++e) {
+            rows += bigHandled(s, e) ? 1 : 0;
+        }
+    }
+    return rows;
+}
+
+struct BigRows {
+    BigTable::Row rows[countBigRows()];
+};
+
+constexpr BigRows makeBigRows() {
+    BigRows result{};
+    int next = 0;
+    for (int s = 0; s < kBigStates; ++s) {
+        for (int e = 0; e < kBigEvents; ++e) {
+            if (bigHandled(s, e)) {
+                result.rows[next++] = BigTable::Row{
+                    static_cast<BigState>(s), static_cast<BigEvent>(e),
+                    static_cast<BigState>(bigTarget(s, e)),
+                    bigGuarded(e) ? evenCount : nullptr,
+                    bigCounts(e) ? countStep : addStep};
+            }
+        }
+    }
+    return result;
+}
+
+constexpr BigRows bigRows = makeBigRows();
+constexpr BigTable bigTable(bigRows.rows);
+
+// Virtual-dispatch version: one flyweight class per state
+// Virtual dispatch 버전: state마다 flyweight class 하나
+class BigStateBase {
+public:
+    virtual const BigStateBase* handle(int event, BigContext& context) const = 0;
+    virtual int id() const = 0;
+    virtual ~BigStateBase() = default;
+};
+
+const BigStateBase* bigState(int state);
+
+template<int S>
+class BigStateImpl : public BigStateBase {
+public:
+    static const BigStateImpl instance;
+
+    // The fold expands to one comparison per event, like a hand-written switch
+    // Fold는 event마다 비교 하나로 펼쳐지며, 직접 작성한 switch와 같음
+    const BigStateBase* handle(int event, BigContext& context) const override {
+        return handleAll(event, context, std::make_integer_sequence<int, kBigEvents>());
+    }
+
+    int id() const override {
+        return S;
+    }
+
+private:
+    template<int... E>
+    const BigStateBase* handleAll(int event, BigContext& context, std::integer_sequence<int, E...>) const {
+        const BigStateBase* next = this;
+        (void)((event == E ? (next = handleOne<E>(context), true) : false) || ...);
+        return next;
+    }
+
+    template<int E>
+    const BigStateBase* handleOne(BigContext& context) const {
+        if constexpr (!bigHandled(S, E)) {
+            return this;
+        } else {
+            if constexpr (bigGuarded(E)) {
+                if (!evenCount(context)) {
+                    return this;
+                }
+            }
+            if constexpr (bigCounts(E)) {
+                countStep(context);
+            } else {
+                addStep(context);
+            }
+            return bigState(bigTarget(S, E));
+        }
+    }
+};
+
+template<int S>
+inline const BigStateImpl<S> BigStateImpl<S>::instance;
+
+template<int... S>
+constexpr std::array<const BigStateBase*, kBigStates> makeBigStates(std::integer_sequence<int, S...>) {
+    return {&BigStateImpl<S>::instance...};
+}
+
+const std::array<const BigStateBase*, kBigStates> bigStates =
+    makeBigStates(std::make_integer_sequence<int, kBigStates>());
+
+const BigStateBase* bigState(int state) {
+    return bigStates[state];
+}
+
+struct DispatchResult {
+    int finalState;
+    BigContext context;
+};
+
+// One pass over the stream through each engine, to check that they agree
+// 각 engine으로 stream을 한 번 통과시켜 결과가 일치하는지 확인
+DispatchResult checkTable(const std::vector<std::uint8_t>& events) {
+    DispatchResult result{};
+    StateMachine<bigTable> machine(BigState{}, result.context);
+    for (std::uint8_t event : events) {
+        machine.dispatch(static_cast<BigEvent>(event));
+    }
+    result.finalState = static_cast<int>(machine.state());
+    return result;
+}
+
+DispatchResult checkVirtual(const std::vector<std::uint8_t>& events) {
+    DispatchResult result{};
+    const BigStateBase* state = bigState(0);
+    for (std::uint8_t event : events) {
+        state = state->handle(event, result.context);
+    }
+    result.finalState = state->id();
+    return result;
+}
+
+// Fleet benchmark: devices pressed per iteration
+// Fleet 벤치마크: iteration마다 누르는 device 수
+constexpr std::size_t kFleetDevices = 1000000;
+
+// Every device sees the same presses, so all of them must share one state
+// 모든 device가 같은 횟수만큼 눌리므로 모두 같은 state에 있어야 함
+void checkUniform(bool uniform, const char* engine) {
+    if (!uniform) {
+        std::cerr << engine << ": devices ended in different states" << std::endl;
+        std::exit(EXIT_FAILURE);
+    }
+}
+
+int main(int argc, char* argv[]) {
+    auto bench = Benchmark<>::fromArgs(argc, argv);
+
+    // A stream without a buffer is in a failed state and discards output
+    // cheaply, so the benchmark measures the engine rather than the terminal
+    // Buffer가 없는 stream은 실패 상태이며 출력을 저렴하게 버리므로, 벤치마크는
+    // terminal이 아니라 engine을 측정함
+    std::ostream quiet(nullptr);
+
+    // Sanity check: an even number of presses ends in Standby
+    // 정상 동작 확인: 짝수 번 누르면 Standby에서 끝남
+    Device check(quiet);
+    check.pressPowerButton();
+    check.pressPowerButton();
+    if (typeid(check.currentState()) != typeid(StandbyState)) {
+        std::cerr << "flyweight engine ended in the wrong state" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    bench.section("Power button transitions, ns per press");
+    legacy::Device oldDevice(quiet);
+    BenchmarkResult oldResult = bench.run("shared_ptr per state", [&oldDevice]() {
+        oldDevice.pressPowerButton();
+    });
+    Device newDevice(quiet);
+    BenchmarkResult newResult = bench.run("flyweight states", [&newDevice]() {
+        newDevice.pressPowerButton();
+    });
+    bench.noteSpeedup(oldResult, newResult);
+
+    // Random event stream shared by both engines
+    // 두 engine이 공유하는 무작위 event stream
+    std::vector<std::uint8_t> events(kEventStream);
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> pick(0, kBigEvents - 1);
+    for (std::uint8_t& event : events) {
+        event = static_cast<std::uint8_t>(pick(rng));
+    }
+
+    DispatchResult table = checkTable(events);
+    DispatchResult virt = checkVirtual(events);
+    if (table.finalState != virt.finalState || table.context.count != virt.context.count
+        || table.context.sum != virt.context.sum) {
+        std::cerr << "table and virtual engines disagree" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    // One iteration dispatches the whole stream; the engines keep their state between iterations
+    // Iteration 하나가 stream 전체를 dispatch함; engine은 iteration 사이에 state를 유지
+    bench.section(std::to_string(kBigStates) + "-state, " + std::to_string(kBigEvents) + "-event machine, "
+                  + std::to_string(kEventStream) + " random events, ns per event");
+    double streamItems = static_cast<double>(events.size());
+    BigContext virtualContext;
+    const BigStateBase* state = bigState(0);
+    BenchmarkResult virtualResult = bench.run("virtual states", [&]() {
+        for (std::uint8_t event : events) {
+            state = state->handle(event, virtualContext);
+        }
+        doNotOptimize(state);
+    }, streamItems);
+    BigContext tableContext;
+    StateMachine<bigTable> machine(BigState{}, tableContext);
+    BenchmarkResult tableResult = bench.run("transition table", [&]() {
+        for (std::uint8_t event : events) {
+            machine.dispatch(static_cast<BigEvent>(event));
+        }
+        clobberMemory();
+    }, streamItems);
+    bench.noteSpeedup(virtualResult, tableResult);
+
+    // One iteration presses the button of every device once
+    // Iteration 하나는 모든 device의 button을 한 번씩 누름
+    bench.section(std::to_string(kFleetDevices) + " devices, ns per device-event");
+    double fleetItems = static_cast<double>(kFleetDevices);
+
+    // One heap object per device, as an application would hold them
+    // Application이 보관하듯 device마다 heap 객체 하나
+    std::vector<std::unique_ptr<Device>> devices;
+    devices.reserve(kFleetDevices);
+    for (std::size_t i = 0; i < kFleetDevices; ++i) {
+        devices.push_back(std::make_unique<Device>(quiet));
+    }
+    BenchmarkResult objectResult = bench.run("Device objects (virtual)", [&devices]() {
+        for (auto& device : devices) {
+            device->pressPowerButton();
+        }
+    }, fleetItems);
+    bool objectsUniform = true;
+    for (const auto& device : devices) {
+        objectsUniform = objectsUniform && typeid(device->currentState()) == typeid(devices.front()->currentState());
+    }
+    checkUniform(objectsUniform, "Device objects");
+    devices.clear();
+
+    PowerContext fleetContext;
+    std::vector<StateMachine<powerFleetTable>> machines(kFleetDevices,
+        StateMachine<powerFleetTable>(Power::Standby, fleetContext));
+    BenchmarkResult machineResult = bench.run("StateMachine objects (table)", [&machines]() {
+        for (auto& fleetMachine : machines) {
+            fleetMachine.dispatch(PowerEvent::Button);
+        }
+    }, fleetItems);
+    bool machinesUniform = true;
+    for (const auto& fleetMachine : machines) {
+        machinesUniform = machinesUniform && fleetMachine.state() == machines.front().state();
+    }
+    checkUniform(machinesUniform, "StateMachine objects");
+    machines.clear();
+
+    PowerFleet scalarFleet(kFleetDevices, Power::Standby, fleetContext);
+    const std::vector<PowerEvent> presses(kFleetDevices, PowerEvent::Button);
+    BenchmarkResult eachResult = bench.run("fleet applyEach (scalar)", [&]() {
+        scalarFleet.applyEach(presses.data());
+    }, fleetItems);
+    std::size_t eachOn = scalarFleet.count(Power::On);
+    checkUniform(eachOn == 0 || eachOn == kFleetDevices, "fleet applyEach");
+
+    PowerFleet batchFleet(kFleetDevices, Power::Standby, fleetContext);
+    BenchmarkResult batchResult = bench.run("fleet applyAll (batch)", [&batchFleet]() {
+        batchFleet.applyAll(PowerEvent::Button);
+    }, fleetItems);
+    std::size_t batchOn = batchFleet.count(Power::On);
+    checkUniform(batchOn == 0 || batchOn == kFleetDevices, "fleet applyAll");
+
+    bench.noteSpeedup(objectResult, machineResult);
+    bench.noteSpeedup(objectResult, eachResult);
+    bench.noteSpeedup(objectResult, batchResult);
+
+    bench.report();
+    return 0;
+}
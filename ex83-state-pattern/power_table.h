@@ -0,0 +1,77 @@
+#ifndef EX83_POWER_TABLE_H
+#define EX83_POWER_TABLE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <ostream>
+
+#include "device_fleet.h"
+#include "state_table.h"
+
+// The Standby/On device expressed as a transition table
+// Transition table로 표현한 Standby/On device
+
+enum class Power : std::uint8_t { Standby, On, Count };
+enum class PowerEvent : std::uint8_t { Button, Count };
+
+// Data the actions work on
+// Action이 사용하는 data
+struct PowerContext {
+    std::ostream* out = &std::cout;
+};
+
+inline void turnOn(PowerContext& context) {
+    *context.out << "Turning ON\n";
+}
+
+inline void turnOff(PowerContext& context) {
+    *context.out << "Turning OFF\n";
+}
+
+using PowerTable = TransitionTable<Power, PowerEvent, PowerContext,
+                                   static_cast<std::size_t>(Power::Count),
+                                   static_cast<std::size_t>(PowerEvent::Count)>;
+
+inline constexpr PowerTable::Row powerRows[] = {
+    // from          event               to              guard    action
+    {Power::Standby, PowerEvent::Button, Power::On,      nullptr, turnOn},
+    {Power::On,      PowerEvent::Button, Power::Standby, nullptr, turnOff},
+};
+
+inline constexpr PowerTable powerTable(powerRows);
+
+using PowerMachine = StateMachine<powerTable>;
+
+// Fleet version: the same transitions without per-device output, so a button
+// press on every device is a pure table lookup
+// Fleet 버전: device별 출력이 없는 같은 transition이므로, 모든 device의 button 누름이
+// 순수 table lookup이 됨
+inline constexpr PowerTable::Row powerFleetRows[] = {
+    {Power::Standby, PowerEvent::Button, Power::On},
+    {Power::On,      PowerEvent::Button, Power::Standby},
+};
+
+inline constexpr PowerTable powerFleetTable(powerFleetRows);
+
+using PowerFleet = DeviceFleet<powerFleetTable>;
+
+// Per-device view with the Device API
+// Device API를 가진 device별 view
+class FleetDevice {
+public:
+    FleetDevice(PowerFleet& fleet, std::size_t index) : view(fleet[index]) {}
+
+    void pressPowerButton() {
+        view.dispatch(PowerEvent::Button);
+    }
+
+    bool isOn() const {
+        return view.state() == Power::On;
+    }
+
+private:
+    PowerFleet::View view;
+};
+
+#endif // EX83_POWER_TABLE_H
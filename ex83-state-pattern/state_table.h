@@ -0,0 +1,128 @@
+#ifndef EX83_STATE_TABLE_H
+#define EX83_STATE_TABLE_H
+
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+
+// One row of a transition table: in state from, event moves to state to
+// Transition table의 한 행: from 상태에서 event가 오면 to 상태로 이동
+//
+// guard, if set, must return true for the transition to fire; action, if
+// set, runs before the state changes. Both are plain functions so a table
+// can be built in a constant expression.
+// guard가 설정되면 true를 반환해야 transition이 일어남; action이 설정되면 상태가
+// 바뀌기 전에 실행됨. 둘 다 일반 함수이므로 table을 constant expression으로 만들 수 있음.
+template<typename State, typename Event, typename Context>
+struct Transition {
+    State from;
+    Event event;
+    State to;
+    bool (*guard)(const Context&) = nullptr;
+    void (*action)(Context&) = nullptr;
+};
+
+// Flat lookup table built from a list of transitions
+// Transition 목록으로부터 만든 flat lookup table
+//
+// Every (state, event) pair has a slot at state * NumEvents + event, so
+// dispatching an event is one indexed load with no search and no virtual
+// call. Build it as a constexpr variable: a duplicate (state, event) pair or
+// an out-of-range value then fails to compile.
+// 모든 (state, event) 쌍은 state * NumEvents + event 위치에 slot을 가지므로, event
+// dispatch는 검색이나 virtual 호출 없이 index load 한 번임. constexpr 변수로 만들면
+// 중복된 (state, event) 쌍이나 범위를 벗어난 값은 compile error가 됨.
+template<typename StateT, typename EventT, typename ContextT, std::size_t NumStates, std::size_t NumEvents>
+class TransitionTable {
+public:
+    using State = StateT;
+    using Event = EventT;
+    using Context = ContextT;
+    using Row = Transition<State, Event, Context>;
+
+    static constexpr std::size_t kNumStates = NumStates;
+    static constexpr std::size_t kNumEvents = NumEvents;
+
+    // What happens when event arrives in a state
+    // 어떤 상태에서 event가 도착했을 때 일어나는 일
+    struct Cell {
+        State to;
+        bool handled; // False if the event is ignored in this state
+                      // 이 상태에서 event가 무시되면 false
+        bool (*guard)(const Context&);
+        void (*action)(Context&);
+    };
+
+    template<std::size_t N>
+    constexpr explicit TransitionTable(const Row (&rows)[N]) : cells() {
+        // Unhandled events leave the state unchanged
+        // 처리되지 않는 event는 상태를 바꾸지 않음
+        for (std::size_t s = 0; s < NumStates; ++s) {
+            for (std::size_t e = 0; e < NumEvents; ++e) {
+                cells[s * NumEvents + e] = Cell{static_cast<State>(s), false, nullptr, nullptr};
+            }
+        }
+        for (const Row& row : rows) {
+            std::size_t from = static_cast<std::size_t>(row.from);
+            std::size_t event = static_cast<std::size_t>(row.event);
+            if (from >= NumStates || event >= NumEvents
+                || static_cast<std::size_t>(row.to) >= NumStates) {
+                throw std::out_of_range("transition uses an unknown state or event");
+            }
+            Cell& cell = cells[from * NumEvents + event];
+            if (cell.handled) {
+                throw std::logic_error("two transitions for the same state and event");
+            }
+            cell = Cell{row.to, true, row.guard, row.action};
+        }
+    }
+
+    constexpr const Cell& at(State state, Event event) const {
+        return cells[static_cast<std::size_t>(state) * NumEvents + static_cast<std::size_t>(event)];
+    }
+
+private:
+    Cell cells[NumStates * NumEvents];
+};
+
+// State machine driven by a constexpr TransitionTable
+// constexpr TransitionTable로 동작하는 state machine
+//
+// The table is a template argument, so its address is a compile-time
+// constant and each machine only stores its current state and context.
+// Table이 template 인자이므로 그 주소는 compile 시점 상수이며, 각 machine은 현재
+// 상태와 context만 보관함.
+template<const auto& Table>
+class StateMachine {
+public:
+    using TableType = std::remove_reference_t<decltype(Table)>;
+    using State = typename TableType::State;
+    using Event = typename TableType::Event;
+    using Context = typename TableType::Context;
+
+    StateMachine(State initial, Context& ctx) : current(initial), context(&ctx) {}
+
+    // Apply one event; returns false if it was ignored or a guard refused it
+    // Event 하나를 적용; 무시되었거나 guard가 거부하면 false 반환
+    bool dispatch(Event event) {
+        const auto& cell = Table.at(current, event);
+        if (!cell.handled || (cell.guard != nullptr && !cell.guard(*context))) {
+            return false;
+        }
+        if (cell.action != nullptr) {
+            cell.action(*context);
+        }
+        current = cell.to;
+        return true;
+    }
+
+    State state() const {
+        return current;
+    }
+
+private:
+    State current;
+    Context* context;
+};
+
+#endif // EX83_STATE_TABLE_H
@@ -0,0 +1,468 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "benchmark.h"
+#include "gpio_pin.h"
+#include "multiton.h"
+
+// Lookups each thread performs per iteration
+// Iteration마다 각 thread가 수행하는 lookup 수
+constexpr long kLookupsPerThread = 1 << 18;
+
+// Pins looked up in each run
+// 각 실행에서 lookup하는 핀 수
+constexpr int kPins = 64;
+
+// Stand-in for a pin in the baselines; only the lookup is measured
+// 기준 구현에서 핀을 대신하는 객체; lookup만 측정함
+struct PinObject {
+    int pin;
+};
+
+// The original registry: a std::map with find() then operator[] twice
+// 기존 registry: find() 후 operator[]를 두 번 호출하는 std::map
+//
+// Lookups of pins that already exist only read the map, so the benchmark can
+// run it from several threads after filling it; creating pins concurrently
+// would be a data race.
+// 이미 존재하는 핀의 lookup은 map을 읽기만 하므로, 채운 뒤에는 여러 thread에서 실행할
+// 수 있음; 동시에 핀을 생성하면 data race임.
+class MapRegistry {
+public:
+    PinObject& get(int pinNumber) {
+        if (instances.find(pinNumber) == instances.end()) {
+            instances[pinNumber] = std::unique_ptr<PinObject>(new PinObject{pinNumber});
+        }
+        return *instances[pinNumber];
+    }
+
+private:
+    std::map<int, std::unique_ptr<PinObject>> instances;
+};
+
+// The map made thread-safe the simple way, with one mutex
+// 단순한 방법으로 thread-safe하게 만든 map, mutex 하나 사용
+class LockedMapRegistry {
+public:
+    PinObject& get(int pinNumber) {
+        std::lock_guard<std::mutex> lock(mtx);
+        return registry.get(pinNumber);
+    }
+
+private:
+    std::mutex mtx;
+    MapRegistry registry;
+};
+
+// Pin numbers outside the dense range, for the hash table path
+// Hash table 경로를 위한 dense 범위 밖의 핀 번호
+int sparsePin(int i) {
+    return 100000 + i * 7919;
+}
+
+// One iteration: numThreads threads each call lookup(pin) kLookupsPerThread times
+// Iteration 하나: numThreads개의 thread가 각각 lookup(pin)을 kLookupsPerThread번 호출
+template<typename Lookup>
+void lookupAll(unsigned numThreads, Lookup& lookup) {
+    std::vector<std::uintptr_t> sinks(numThreads);
+
+    std::vector<std::thread> threads;
+    for (unsigned t = 0; t < numThreads; ++t) {
+        threads.emplace_back([&lookup, &sinks, t]() {
+            std::uintptr_t sink = 0;
+            for (long n = 0; n < kLookupsPerThread; ++n) {
+                sink += reinterpret_cast<std::uintptr_t>(&lookup(static_cast<int>(n % kPins)));
+            }
+            sinks[t] = sink;
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // Every thread saw the same objects, so the sums must match
+    // 모든 thread가 같은 객체를 보았으므로 합계가 같아야 함
+    for (unsigned t = 1; t < numThreads; ++t) {
+        if (sinks[t] != sinks[0]) {
+            std::cerr << "Threads saw different instances" << std::endl;
+            std::exit(1);
+        }
+    }
+}
+
+// The original pin: a bool plus a flushed std::endl line per write
+// 기존 핀: bool 하나와 쓰기마다 std::endl로 flush되는 한 줄
+class LegacyPin {
+public:
+    LegacyPin(int pinNumber, std::ostream& log) : pin(pinNumber), state(false), out(log) {}
+
+    void setHigh() {
+        state = true;
+        out << "[GPIO" << pin << "] Set to HIGH" << std::endl;
+    }
+
+    void setLow() {
+        state = false;
+        out << "[GPIO" << pin << "] Set to LOW" << std::endl;
+    }
+
+    bool getState() const {
+        return state;
+    }
+
+private:
+    int pin;
+    bool state;
+    std::ostream& out;
+};
+
+// Object managed by the generic multiton benchmark
+// Generic multiton 벤치마크가 관리하는 객체
+struct Instance {
+    explicit Instance(int k) : key(k) {}
+
+    int key;
+    std::uint64_t data[3] = {};
+};
+
+// Random lookups per multiton configuration
+// Multiton 설정마다의 무작위 lookup 수
+constexpr long kMultitonLookups = 1000000;
+
+// LRU capacity and the keys held by refcount users: a tenth of the keys
+// LRU capacity와 refcount 사용자가 보유하는 key: 전체 key의 1/10
+constexpr int kActiveFraction = 10;
+
+// Resident set size of this process in bytes
+// 이 process의 resident set 크기 (byte)
+std::size_t residentBytes() {
+    std::ifstream statm("/proc/self/statm");
+    std::size_t pages = 0;
+    std::size_t resident = 0;
+    statm >> pages >> resident;
+    return resident * static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+}
+
+// Keep a handle alive; NeverEvict hands out references
+// Handle을 유지; NeverEvict는 reference를 반환함
+template<typename Handle>
+struct Holder {
+    std::vector<Handle> handles;
+
+    void keep(Handle handle) {
+        handles.push_back(std::move(handle));
+    }
+};
+
+template<typename T>
+struct Holder<T&> {
+    void keep(T&) {}
+};
+
+const Instance& instanceOf(const Instance& instance) {
+    return instance;
+}
+
+const Instance& instanceOf(const std::shared_ptr<Instance>& instance) {
+    return *instance;
+}
+
+// Only the LRU policy takes a capacity
+// LRU policy만 capacity를 받음
+template<typename Storage, typename Eviction>
+void construct(std::optional<Multiton<int, Instance, Storage, Eviction>>& multiton, int numKeys) {
+    if constexpr (std::is_same<Eviction, LruEvict>::value) {
+        multiton.emplace(static_cast<std::size_t>(numKeys / kActiveFraction));
+    } else {
+        (void)numKeys;
+        multiton.emplace();
+    }
+}
+
+// Fill a multiton with numKeys keys, then time random lookups over all keys
+// numKeys개의 key로 multiton을 채운 뒤, 전체 key에 대한 무작위 lookup 시간을 측정
+//
+// Every tenth key stays referenced by a user, which is what keeps it alive
+// under RefCountEvict. Runs in a child process so that the resident memory
+// it reports is not inflated by earlier configurations.
+// 10번째 key마다 사용자가 참조를 유지하며, RefCountEvict에서는 이것이 key를 살려둠.
+// 보고하는 resident memory가 이전 설정의 영향을 받지 않도록 child process에서 실행함.
+template<typename Storage, typename Eviction>
+void multitonRow(const char* storage, const char* eviction, int numKeys) {
+    std::cout.flush();
+    pid_t child = fork();
+    if (child != 0) {
+        int status = 0;
+        waitpid(child, &status, 0);
+        return;
+    }
+
+    std::vector<int> lookups(kMultitonLookups);
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<int> pick(0, numKeys - 1);
+    for (int& key : lookups) {
+        key = pick(rng);
+    }
+
+    std::size_t before = residentBytes();
+    {
+        std::optional<Multiton<int, Instance, Storage, Eviction>> holder;
+        construct(holder, numKeys);
+        auto& multiton = *holder;
+        Holder<typename Multiton<int, Instance, Storage, Eviction>::Handle> users;
+        for (int key = 0; key < numKeys; ++key) {
+            auto&& handle = multiton.get(key);
+            if (key % kActiveFraction == 0) {
+                users.keep(handle);
+            }
+        }
+        std::size_t memory = residentBytes() - before;
+
+        long sum = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (int key : lookups) {
+            sum += instanceOf(multiton.get(key)).key == key ? 1 : 0;
+        }
+        auto end = std::chrono::steady_clock::now();
+        if (sum != kMultitonLookups) {
+            std::cerr << "multiton returned the wrong instance" << std::endl;
+            _exit(1);
+        }
+
+        double ns = std::chrono::duration<double, std::nano>(end - start).count() / kMultitonLookups;
+        std::cout << std::setw(8) << storage << std::setw(10) << eviction << std::setw(10) << numKeys
+                  << std::fixed << std::setprecision(1) << std::setw(12) << ns
+                  << std::setw(12) << multiton.size()
+                  << std::setw(12) << memory / 1048576.0
+                  << std::setw(12) << double(memory) / numKeys << std::endl;
+    }
+    std::cout.flush();
+    _exit(0);
+}
+
+template<typename Eviction>
+void multitonRows(const char* eviction, int numKeys) {
+    multitonRow<DenseStorage, Eviction>("dense", eviction, numKeys);
+    multitonRow<HashStorage, Eviction>("hash", eviction, numKeys);
+    multitonRow<MapStorage, Eviction>("map", eviction, numKeys);
+}
+
+// Many threads request the same new pins at once; each pin must be created once
+// 여러 thread가 동시에 같은 새 핀을 요청; 각 핀은 한 번만 생성되어야 함
+void checkFirstLookups(unsigned numThreads) {
+    const int firstPin = kPins;
+    std::vector<std::vector<GpioPin*>> seen(numThreads);
+    std::vector<std::thread> threads;
+    for (unsigned t = 0; t < numThreads; ++t) {
+        threads.emplace_back([&seen, t, firstPin]() {
+            for (int i = 0; i < kPins; ++i) {
+                seen[t].push_back(&GpioPin::getInstance(firstPin + i));
+                seen[t].push_back(&GpioPin::getInstance(sparsePin(kPins + i)));
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (unsigned t = 1; t < numThreads; ++t) {
+        if (seen[t] != seen[0]) {
+            std::cerr << "Concurrent first lookups created duplicate pins" << std::endl;
+            std::exit(1);
+        }
+    }
+}
+
+// Channel that fails to open on every other attempt, like busy hardware
+// 바쁜 hardware처럼 두 번에 한 번 열기에 실패하는 channel
+struct FlakyChannel {
+    static inline int attempts = 0;
+    int key;
+
+    explicit FlakyChannel(int k) : key(k) {
+        if (attempts++ % 2 == 0) {
+            throw std::runtime_error("channel busy");
+        }
+    }
+};
+
+int keyOf(const FlakyChannel& channel) {
+    return channel.key;
+}
+
+int keyOf(const std::shared_ptr<FlakyChannel>& channel) {
+    return channel->key;
+}
+
+// A constructor that throws must leave no entry behind: the next get() of the key builds it once
+// Constructor가 throw하면 entry가 남지 않아야 함: 그 key의 다음 get()이 한 번 생성함
+template<typename Storage, typename Eviction>
+bool checkThrowingConstructor() {
+    using Channels = Multiton<int, FlakyChannel, Storage, Eviction>;
+    FlakyChannel::attempts = 0;
+    Channels channels;
+    Holder<typename Channels::Handle> users;
+    for (int key = 0; key < 8; ++key) {
+        try {
+            channels.get(key);
+            return false;
+        } catch (const std::runtime_error&) {
+        }
+        if (channels.size() != static_cast<std::size_t>(key)) {
+            return false;
+        }
+        users.keep(channels.get(key));
+        if (keyOf(channels.get(key)) != key || channels.size() != static_cast<std::size_t>(key + 1)
+            || FlakyChannel::attempts != 2 * (key + 1)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template<typename Eviction>
+bool checkThrowingConstructors() {
+    return checkThrowingConstructor<DenseStorage, Eviction>() && checkThrowingConstructor<HashStorage, Eviction>()
+           && checkThrowingConstructor<MapStorage, Eviction>();
+}
+
+int main(int argc, char* argv[]) {
+    // Harness options (--format=csv, --samples=N, ...) are removed from argv
+    // Harness option (--format=csv, --samples=N, ...)은 argv에서 제거됨
+    auto bench = Benchmark<>::fromArgs(argc, argv);
+
+    // Maximum thread count: first argument, or the number of hardware threads
+    // 최대 thread 수: 첫 번째 인자 또는 hardware thread 수
+    unsigned maxThreads = std::thread::hardware_concurrency();
+    if (argc > 1) {
+        maxThreads = static_cast<unsigned>(std::atoi(argv[1]));
+    }
+    if (maxThreads == 0) {
+        maxThreads = 1;
+    }
+
+    // GpioPin reports every creation and release; keep the table readable
+    // GpioPin은 생성과 해제를 모두 출력하므로, 표를 읽기 쉽게 유지
+    std::cout.setstate(std::ios::badbit);
+    checkFirstLookups(maxThreads < 2 ? 2 : maxThreads);
+    if (!checkThrowingConstructors<NeverEvict>() || !checkThrowingConstructors<LruEvict>()
+        || !checkThrowingConstructors<RefCountEvict>()) {
+        std::cerr << "A throwing constructor left a broken multiton entry" << std::endl;
+        return 1;
+    }
+    MapRegistry map;
+    LockedMapRegistry lockedMap;
+    for (int i = 0; i < kPins; ++i) {
+        map.get(i);
+        lockedMap.get(i);
+        GpioPin::getInstance(i);
+        GpioPin::getInstance(sparsePin(i));
+    }
+    std::cout.clear();
+
+    auto mapLookup = [&map](int pin) -> PinObject& { return map.get(pin); };
+    auto lockedLookup = [&lockedMap](int pin) -> PinObject& { return lockedMap.get(pin); };
+    auto denseLookup = [](int pin) -> GpioPin& { return GpioPin::getInstance(pin); };
+    auto sparseLookup = [](int pin) -> GpioPin& { return GpioPin::getInstance(sparsePin(pin)); };
+    const double lookups = static_cast<double>(kLookupsPerThread);
+    for (unsigned n = 1; n <= maxThreads; ++n) {
+        bench.section("GPIO pin lookups, " + std::to_string(n) + " thread(s), " + std::to_string(kPins)
+                      + " pins, ns per lookup per thread");
+        bench.run("map", [&]() { lookupAll(n, mapLookup); }, lookups);
+        bench.run("map+mutex", [&]() { lookupAll(n, lockedLookup); }, lookups);
+        bench.run("dense", [&]() { lookupAll(n, denseLookup); }, lookups);
+        bench.run("sparse", [&]() { lookupAll(n, sparseLookup); }, lookups);
+    }
+
+    // Write side: the log goes to /dev/null so the terminal is not measured
+    // 쓰기: terminal을 측정하지 않도록 log는 /dev/null로 보냄
+    std::ofstream devNull("/dev/null");
+    GpioLog::instance().setOutput(devNull);
+
+    std::vector<std::unique_ptr<LegacyPin>> legacyPins;
+    std::vector<GpioPin*> pins;
+    for (int i = 0; i < kPins; ++i) {
+        legacyPins.emplace_back(new LegacyPin(i, devNull));
+        pins.push_back(&GpioPin::getInstance(i));
+    }
+    GpioPort& port = GpioPort::bank(0);
+    const std::uint64_t allPins = ~std::uint64_t(0);
+
+    // One iteration drives all pins of port 0 high, then low
+    // Iteration 하나는 port 0의 모든 핀을 HIGH로, 다시 LOW로 바꿈
+    bench.section("GPIO writes, " + std::to_string(kPins) + " pins of port 0, ns per pin update");
+    const double updates = 2.0 * kPins;
+    bench.run("per pin, std::endl", [&legacyPins]() {
+        for (auto& pin : legacyPins) {
+            pin->setHigh();
+        }
+        for (auto& pin : legacyPins) {
+            pin->setLow();
+        }
+    }, updates);
+    bench.run("per pin, buffered log", [&pins]() {
+        for (GpioPin* pin : pins) {
+            pin->setHigh();
+        }
+        for (GpioPin* pin : pins) {
+            pin->setLow();
+        }
+    }, updates);
+    bench.run("masked port write", [&port, allPins]() {
+        port.setPins(allPins);
+        port.clearPins(allPins);
+    }, updates);
+    // Writes that found the 4096-record ring full and waited for the drain thread
+    // 4096개 record의 ring이 가득 차서 drain thread를 기다린 쓰기 수
+    bench.note("    buffered log: " + std::to_string(GpioLog::instance().stalls()) + " stalls on a full ring");
+    // The log outlives devNull, so point it back at std::cout once it is drained
+    // Log는 devNull보다 오래 살므로 비운 뒤 다시 std::cout을 가리키게 함
+    GpioLog::instance().flush();
+    GpioLog::instance().setOutput(std::cout);
+    if (port.read() != 0 || pins[0]->getState()) {
+        std::cerr << "Port 0 did not end LOW" << std::endl;
+        return 1;
+    }
+
+    // The multiton rows run in child processes to report resident memory, so
+    // they are printed in table format only
+    // Multiton 행은 resident memory를 보고하기 위해 child process에서 실행되므로 table
+    // 형식에서만 출력됨
+    bench.report();
+    if (bench.reportFormat() != ReportFormat::Table) {
+        std::cout.setstate(std::ios::badbit);
+        return 0;
+    }
+
+    std::cout << "\nGeneric Multiton<int, Instance, Storage, Eviction> (" << kMultitonLookups
+              << " random lookups, LRU keeps and users hold 1/" << kActiveFraction << " of the keys)" << std::endl;
+    std::cout << std::setw(8) << "storage" << std::setw(10) << "eviction" << std::setw(10) << "keys"
+              << std::setw(12) << "ns/lookup" << std::setw(12) << "live" << std::setw(12) << "RSS MB"
+              << std::setw(12) << "bytes/key" << std::endl;
+    for (int numKeys : {1000, 100000, 10000000}) {
+        multitonRows<NeverEvict>("never", numKeys);
+        multitonRows<LruEvict>("lru", numKeys);
+        multitonRows<RefCountEvict>("refcount", numKeys);
+    }
+
+    // Silence the release messages printed when the registry is destroyed
+    // Registry가 소멸될 때 출력되는 해제 메시지를 숨김
+    std::cout.setstate(std::ios::badbit);
+    return 0;
+}
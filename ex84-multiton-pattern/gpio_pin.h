@@ -0,0 +1,205 @@
+#ifndef EX84_GPIO_PIN_H
+#define EX84_GPIO_PIN_H
+
+#include <atomic>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+#include "gpio_port.h"
+
+class PinRegistry;
+
+// Multiton class definition - GPIO pin controller
+// Multiton 클래스 정의 - GPIO 핀 컨트롤러
+class GpioPin {
+public:
+    // Static method to get instance by pin number; safe to call from any thread
+    // 핀 번호로 인스턴스를 얻기 위한 정적 메서드; 어느 스레드에서 호출해도 안전
+    static GpioPin& getInstance(int pinNumber);
+
+    // Delete copy constructor to prevent copying
+    // 복사를 방지하기 위해 복사 생성자 삭제
+    GpioPin(const GpioPin&) = delete;
+
+    // Delete copy assignment operator to prevent copying
+    // 복사를 방지하기 위해 복사 대입 연산자 삭제
+    GpioPin& operator=(const GpioPin&) = delete;
+
+    // Delete move constructor to prevent moving
+    // 이동을 방지하기 위해 이동 생성자 삭제
+    GpioPin(GpioPin&&) = delete;
+
+    // Delete move assignment operator to prevent moving
+    // 이동을 방지하기 위해 이동 대입 연산자 삭제
+    GpioPin& operator=(GpioPin&&) = delete;
+
+    // Method to set pin high; the message goes to the buffered GpioLog
+    // 핀을 HIGH로 설정하는 메서드; 메시지는 buffered GpioLog로 감
+    void setHigh() {
+        reg->set(bit);
+        GpioLog::instance().record(GpioRecord{GpioOp::PinHigh, pin, bit, 0, 0});
+    }
+
+    // Method to set pin low; the message goes to the buffered GpioLog
+    // 핀을 LOW로 설정하는 메서드; 메시지는 buffered GpioLog로 감
+    void setLow() {
+        reg->clear(bit);
+        GpioLog::instance().record(GpioRecord{GpioOp::PinLow, pin, 0, bit, 0});
+    }
+
+    // Method to get pin state
+    // 핀 상태를 얻는 메서드
+    bool getState() const {
+        return (reg->read() & bit) != 0;
+    }
+
+    // Destructor
+    // 소멸자
+    ~GpioPin() {
+        std::cout << "GPIO pin " << pin << " released" << std::endl;
+    }
+
+private:
+    int pin;
+    std::uint64_t bit;          // This pin's bit in *reg
+                                // *reg 안에서 이 핀의 bit
+    PortRegister* reg;          // Bank port register, or ownRegister
+                                // Bank port register 또는 ownRegister
+    PortRegister ownRegister;   // Used by pins outside the bank
+                                // Bank 밖의 핀이 사용
+
+    // Private constructor to prevent direct instantiation
+    // 직접 인스턴스화를 방지하기 위한 private 생성자
+    explicit GpioPin(int pinNumber) : pin(pinNumber), bit(1), reg(&ownRegister) {
+        if (pinNumber >= 0 && pinNumber < GpioPort::kPinsPerPort * GpioPort::kBankPorts) {
+            bit = std::uint64_t(1) << (pinNumber % GpioPort::kPinsPerPort);
+            reg = &GpioPort::bank(pinNumber / GpioPort::kPinsPerPort).outputRegister();
+        }
+        reg->clear(bit); // A new pin starts LOW
+                         // 새 핀은 LOW로 시작
+        std::cout << "GPIO pin " << pin << " initialized" << std::endl;
+    }
+
+    // The registry is the only place that creates pins
+    // Registry만 핀을 생성할 수 있음
+    friend class PinRegistry;
+};
+
+// Lock-free registry of GpioPin instances
+// GpioPin 인스턴스의 lock-free registry
+//
+// Pins 0..kDensePins-1 live in an array indexed by pin number, so a lookup
+// is one atomic load. The first lookup of a pin constructs it under the
+// slot's std::once_flag, so concurrent first lookups create exactly one pin.
+// Other pin numbers go to a fixed-size open-addressing hash table whose keys
+// are claimed with a CAS; the thread that claims a key constructs the pin and
+// the others wait for it to be published. After construction no lookup takes
+// a lock.
+// 핀 0..kDensePins-1은 핀 번호로 indexing되는 배열에 있으므로 lookup은 atomic load
+// 한 번임. 핀의 첫 lookup은 slot의 std::once_flag 아래에서 생성하므로, 동시에 처음
+// lookup해도 핀은 정확히 하나만 생성됨. 그 외 핀 번호는 고정 크기 open-addressing hash
+// table로 가며, key는 CAS로 차지함; key를 차지한 thread가 핀을 생성하고 나머지는
+// 공개될 때까지 대기함. 생성 이후의 lookup은 lock을 잡지 않음.
+class PinRegistry {
+public:
+    static constexpr int kDensePins = 256;
+    static constexpr unsigned kSparseBits = 10;
+    static constexpr std::size_t kSparseSlots = std::size_t(1) << kSparseBits;
+
+    PinRegistry() = default;
+    PinRegistry(const PinRegistry&) = delete;
+    PinRegistry& operator=(const PinRegistry&) = delete;
+
+    // Release the pins in pin order for the dense range
+    // Dense 범위는 핀 번호 순서로 해제
+    ~PinRegistry() {
+        for (DenseSlot& slot : dense) {
+            delete slot.pin.load(std::memory_order_acquire);
+        }
+        for (SparseSlot& slot : sparse) {
+            delete slot.pin.load(std::memory_order_acquire);
+        }
+    }
+
+    // Return the pin, creating it on first use
+    // 핀을 반환하며, 처음 사용할 때 생성
+    GpioPin& get(int pinNumber) {
+        if (pinNumber >= 0 && pinNumber < kDensePins) {
+            DenseSlot& slot = dense[pinNumber];
+            GpioPin* pin = slot.pin.load(std::memory_order_acquire);
+            if (pin != nullptr) {
+                return *pin;
+            }
+            std::call_once(slot.once, [&slot, pinNumber]() {
+                slot.pin.store(new GpioPin(pinNumber), std::memory_order_release);
+            });
+            return *slot.pin.load(std::memory_order_acquire);
+        }
+        return getSparse(pinNumber);
+    }
+
+private:
+    struct DenseSlot {
+        std::atomic<GpioPin*> pin{nullptr};
+        std::once_flag once;
+    };
+
+    // INT_MIN marks an unused slot, so it cannot be used as a pin number
+    // INT_MIN은 사용되지 않은 slot을 뜻하므로 핀 번호로 사용할 수 없음
+    struct SparseSlot {
+        std::atomic<int> key{INT_MIN};
+        std::atomic<GpioPin*> pin{nullptr};
+    };
+
+    DenseSlot dense[kDensePins];
+    SparseSlot sparse[kSparseSlots];
+
+    // Fibonacci hashing: the top bits of the product spread nearby pin numbers
+    // Fibonacci hashing: 곱의 상위 bit가 가까운 핀 번호를 분산시킴
+    static std::size_t slotFor(int pinNumber) {
+        std::uint64_t mixed = static_cast<std::uint64_t>(static_cast<unsigned>(pinNumber)) * 0x9E3779B97F4A7C15ull;
+        return static_cast<std::size_t>(mixed >> (64 - kSparseBits));
+    }
+
+    GpioPin& getSparse(int pinNumber) {
+        if (pinNumber == INT_MIN) {
+            throw std::invalid_argument("INT_MIN is not a valid pin number");
+        }
+        std::size_t start = slotFor(pinNumber);
+        for (std::size_t probe = 0; probe < kSparseSlots; ++probe) {
+            SparseSlot& slot = sparse[(start + probe) & (kSparseSlots - 1)];
+            int key = slot.key.load(std::memory_order_acquire);
+            if (key == INT_MIN) {
+                // Try to claim the empty slot; the winner creates the pin
+                // 빈 slot 차지를 시도; 성공한 thread가 핀을 생성
+                if (slot.key.compare_exchange_strong(key, pinNumber, std::memory_order_acq_rel)) {
+                    GpioPin* pin = new GpioPin(pinNumber);
+                    slot.pin.store(pin, std::memory_order_release);
+                    return *pin;
+                }
+                // Lost the race: key now holds the winner's pin number
+                // 경쟁에서 짐: key에는 이긴 thread의 핀 번호가 들어 있음
+            }
+            if (key == pinNumber) {
+                GpioPin* pin;
+                while ((pin = slot.pin.load(std::memory_order_acquire)) == nullptr) {
+                    std::this_thread::yield();
+                }
+                return *pin;
+            }
+        }
+        throw std::length_error("too many sparse GPIO pins");
+    }
+};
+
+inline GpioPin& GpioPin::getInstance(int pinNumber) {
+    static PinRegistry registry;
+    return registry.get(pinNumber);
+}
+
+#endif // EX84_GPIO_PIN_H
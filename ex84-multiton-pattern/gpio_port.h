@@ -0,0 +1,267 @@
+#ifndef EX84_GPIO_PORT_H
+#define EX84_GPIO_PORT_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <iostream>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+
+#include "ring_buffer.h"
+
+// Simulated 64-bit GPIO output register, one bit per pin
+// 시뮬레이션된 64-bit GPIO output register, 핀마다 bit 하나
+//
+// Like the set/clear/toggle registers of real GPIO hardware, every write
+// changes only the pins in its masks and is a single atomic operation, so
+// writers to different pins of the same port never lose each other's
+// updates.
+// 실제 GPIO hardware의 set/clear/toggle register처럼 모든 쓰기는 mask에 있는 핀만
+// 바꾸며 하나의 atomic 연산이므로, 같은 port의 서로 다른 핀에 쓰는 writer가 서로의
+// 변경을 잃지 않음.
+class PortRegister {
+public:
+    std::uint64_t read() const {
+        return bits.load(std::memory_order_acquire);
+    }
+
+    void set(std::uint64_t mask) {
+        bits.fetch_or(mask, std::memory_order_acq_rel);
+    }
+
+    void clear(std::uint64_t mask) {
+        bits.fetch_and(~mask, std::memory_order_acq_rel);
+    }
+
+    void toggle(std::uint64_t mask) {
+        bits.fetch_xor(mask, std::memory_order_acq_rel);
+    }
+
+    // Set, then clear, then toggle in one atomic read-modify-write
+    // Set, clear, toggle을 순서대로 하나의 atomic read-modify-write로 적용
+    void apply(std::uint64_t setMask, std::uint64_t clearMask, std::uint64_t toggleMask) {
+        std::uint64_t old = bits.load(std::memory_order_relaxed);
+        while (!bits.compare_exchange_weak(old, ((old | setMask) & ~clearMask) ^ toggleMask,
+                                           std::memory_order_acq_rel, std::memory_order_relaxed)) {
+        }
+    }
+
+private:
+    std::atomic<std::uint64_t> bits{0};
+};
+
+// What a log record describes
+// Log record가 나타내는 동작
+enum class GpioOp : std::uint8_t {
+    PinHigh,
+    PinLow,
+    PortWrite,
+};
+
+struct GpioRecord {
+    GpioOp op;
+    int id; // Pin number, or port number for PortWrite
+            // 핀 번호, PortWrite이면 port 번호
+    std::uint64_t setMask;
+    std::uint64_t clearMask;
+    std::uint64_t toggleMask;
+};
+
+// Buffered log sink for GPIO writes
+// GPIO 쓰기를 위한 buffered log sink
+//
+// Writers only push a small binary record into a lock-free ring buffer. The
+// text is formatted when the sink is flushed and written to the output in one
+// call, instead of one flushed std::endl line per write. A flush happens on
+// request, at exit, or when a writer finds the ring full. In the last case the
+// writer never takes the lock or writes the output itself. It wakes a
+// background drain thread and yields until there is room. Such a stall is
+// counted by stalls(), so a ring that is too small for the write rate shows up.
+// Writer는 작은 binary record를 lock-free ring buffer에 넣기만 함. Text는 sink가
+// flush될 때 만들어지며, 쓰기마다 std::endl로 flush되는 한 줄 대신 한 번의 호출로
+// output에 기록됨. Flush는 요청할 때, 종료 시, 또는 writer가 ring이 가득 찬 것을 볼 때
+// 일어남. 마지막 경우에 writer는 직접 lock을 잡거나 output에 쓰지 않음. Background
+// drain thread를 깨우고 공간이 생길 때까지 yield함. 이런 stall은 stalls()로 세므로,
+// 쓰기 속도에 비해 너무 작은 ring이 드러남.
+class GpioLog {
+public:
+    static GpioLog& instance() {
+        static GpioLog log;
+        return log;
+    }
+
+    GpioLog(const GpioLog&) = delete;
+    GpioLog& operator=(const GpioLog&) = delete;
+
+    void record(const GpioRecord& entry) {
+        if (records.try_push(entry)) {
+            return;
+        }
+        stallCount.fetch_add(1, std::memory_order_relaxed);
+        drainRequested.store(true, std::memory_order_release);
+        // Notify on every retry, so a wake-up that races with the drain thread going to sleep is not lost
+        // 재시도마다 notify하므로, drain thread가 잠드는 순간과 겹친 wake-up도 사라지지 않음
+        do {
+            drainWake.notify_one();
+            std::this_thread::yield();
+        } while (!records.try_push(entry));
+    }
+
+    // Format every pending record and write them with one call
+    // 대기 중인 모든 record를 format하여 한 번의 호출로 기록
+    void flush() {
+        std::lock_guard<std::mutex> lock(flushMutex);
+        std::string text;
+        GpioRecord entry;
+        while (records.try_pop(entry)) {
+            format(entry, text);
+        }
+        if (!text.empty()) {
+            out->write(text.data(), static_cast<std::streamsize>(text.size()));
+            out->flush();
+        }
+    }
+
+    // Redirect the formatted output (std::cout by default)
+    // Format된 출력의 대상을 변경 (기본값 std::cout)
+    void setOutput(std::ostream& stream) {
+        std::lock_guard<std::mutex> lock(flushMutex);
+        out = &stream;
+    }
+
+    // Number of times a writer found the ring full and had to wait for the drain thread
+    // Writer가 ring이 가득 찬 것을 보고 drain thread를 기다려야 했던 횟수
+    std::uint64_t stalls() const {
+        return stallCount.load(std::memory_order_relaxed);
+    }
+
+private:
+    RingBuffer<GpioRecord> records;
+    std::mutex flushMutex;
+    std::ostream* out;
+
+    std::atomic<std::uint64_t> stallCount{0};
+    std::atomic<bool> drainRequested{false};
+    std::mutex drainMutex;
+    std::condition_variable drainWake;
+    bool stopping = false; // Guarded by drainMutex
+                           // drainMutex로 보호됨
+    std::thread drainer;
+
+    GpioLog() : records(4096), out(&std::cout), drainer([this]() { drainLoop(); }) {}
+
+    ~GpioLog() {
+        {
+            std::lock_guard<std::mutex> lock(drainMutex);
+            stopping = true;
+        }
+        drainWake.notify_one();
+        drainer.join();
+        flush();
+    }
+
+    // Flush whenever a writer finds the ring full
+    // Writer가 ring이 가득 찬 것을 볼 때마다 flush
+    void drainLoop() {
+        std::unique_lock<std::mutex> lock(drainMutex);
+        while (true) {
+            drainWake.wait(lock, [this]() { return stopping || drainRequested.load(std::memory_order_acquire); });
+            if (stopping) {
+                return;
+            }
+            drainRequested.store(false, std::memory_order_relaxed);
+            lock.unlock();
+            flush();
+            lock.lock();
+        }
+    }
+
+    static void format(const GpioRecord& entry, std::string& text) {
+        char line[128];
+        switch (entry.op) {
+        case GpioOp::PinHigh:
+            std::snprintf(line, sizeof(line), "[GPIO%d] Set to HIGH\n", entry.id);
+            break;
+        case GpioOp::PinLow:
+            std::snprintf(line, sizeof(line), "[GPIO%d] Set to LOW\n", entry.id);
+            break;
+        case GpioOp::PortWrite:
+            std::snprintf(line, sizeof(line), "[PORT%d] set 0x%016llx clear 0x%016llx toggle 0x%016llx\n",
+                          entry.id, static_cast<unsigned long long>(entry.setMask),
+                          static_cast<unsigned long long>(entry.clearMask),
+                          static_cast<unsigned long long>(entry.toggleMask));
+            break;
+        }
+        text += line;
+    }
+};
+
+// A port of 64 pins written through masks
+// Mask로 쓰는 64개 핀의 port
+//
+// Pin n of the bank is bit n % 64 of port n / 64. One masked write updates
+// any number of the port's pins with one atomic operation and one log record.
+// Bank의 핀 n은 port n / 64의 bit n % 64임. Mask 쓰기 한 번은 port의 핀을 몇 개든
+// atomic 연산 하나와 log record 하나로 변경함.
+class GpioPort {
+public:
+    static constexpr int kPinsPerPort = 64;
+    static constexpr int kBankPorts = 4; // Pins 0..255
+                                         // 핀 0..255
+
+    // Port of the bank by port number (0 to kBankPorts - 1)
+    // Port 번호로 bank의 port를 얻음 (0부터 kBankPorts - 1)
+    static GpioPort& bank(int portNumber) {
+        static GpioPort ports[kBankPorts] = {{0}, {1}, {2}, {3}};
+        return ports[portNumber];
+    }
+
+    GpioPort(int portNumber) : port(portNumber) {}
+
+    GpioPort(const GpioPort&) = delete;
+    GpioPort& operator=(const GpioPort&) = delete;
+
+    void setPins(std::uint64_t mask) {
+        reg.set(mask);
+        GpioLog::instance().record(GpioRecord{GpioOp::PortWrite, port, mask, 0, 0});
+    }
+
+    void clearPins(std::uint64_t mask) {
+        reg.clear(mask);
+        GpioLog::instance().record(GpioRecord{GpioOp::PortWrite, port, 0, mask, 0});
+    }
+
+    void togglePins(std::uint64_t mask) {
+        reg.toggle(mask);
+        GpioLog::instance().record(GpioRecord{GpioOp::PortWrite, port, 0, 0, mask});
+    }
+
+    // Set, clear and toggle in one atomic write
+    // Set, clear, toggle을 하나의 atomic 쓰기로 적용
+    void write(std::uint64_t setMask, std::uint64_t clearMask, std::uint64_t toggleMask = 0) {
+        reg.apply(setMask, clearMask, toggleMask);
+        GpioLog::instance().record(GpioRecord{GpioOp::PortWrite, port, setMask, clearMask, toggleMask});
+    }
+
+    std::uint64_t read() const {
+        return reg.read();
+    }
+
+    int number() const {
+        return port;
+    }
+
+    PortRegister& outputRegister() {
+        return reg;
+    }
+
+private:
+    int port;
+    PortRegister reg;
+};
+
+#endif // EX84_GPIO_PORT_H
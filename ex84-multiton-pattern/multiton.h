@@ -0,0 +1,396 @@
+#ifndef EX84_MULTITON_H
+#define EX84_MULTITON_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <map>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+// Storage policies: where the multiton keeps one entry per key
+// Storage policy: multiton이 key마다 entry 하나를 보관하는 곳
+//
+// Each policy provides Store<Key, Entry> with
+//   Entry* find(const Key&)
+//   Entry& findOrInsert(const Key&, bool& inserted)
+//   void erase(const Key&)
+//   std::size_t size() const
+// 각 policy는 위의 함수를 가진 Store<Key, Entry>를 제공함
+
+// Dense array indexed by the key; for small non-negative integer keys
+// Key로 indexing되는 dense 배열; 작은 음이 아닌 정수 key용
+struct DenseStorage {
+    template<typename Key, typename Entry>
+    class Store {
+    public:
+        Entry* find(const Key& key) {
+            std::size_t index = static_cast<std::size_t>(key);
+            return (index < slots.size() && slots[index]) ? &*slots[index] : nullptr;
+        }
+
+        Entry& findOrInsert(const Key& key, bool& inserted) {
+            std::size_t index = static_cast<std::size_t>(key);
+            if (index >= slots.size()) {
+                slots.resize(index + 1);
+            }
+            inserted = !slots[index];
+            if (inserted) {
+                slots[index].emplace();
+                ++count;
+            }
+            return *slots[index];
+        }
+
+        void erase(const Key& key) {
+            std::size_t index = static_cast<std::size_t>(key);
+            if (index < slots.size() && slots[index]) {
+                slots[index].reset();
+                --count;
+            }
+        }
+
+        std::size_t size() const {
+            return count;
+        }
+
+    private:
+        std::vector<std::optional<Entry>> slots;
+        std::size_t count = 0;
+    };
+};
+
+// Open-addressing hash table with linear probing, for any hashable key
+// Linear probing을 사용하는 open-addressing hash table, hash 가능한 모든 key용
+struct HashStorage {
+    template<typename Key, typename Entry>
+    class Store {
+    public:
+        Store() : buckets(16) {}
+
+        Entry* find(const Key& key) {
+            std::size_t index = locate(key);
+            return buckets[index].entry ? &*buckets[index].entry : nullptr;
+        }
+
+        Entry& findOrInsert(const Key& key, bool& inserted) {
+            std::size_t index = locate(key);
+            inserted = !buckets[index].entry;
+            if (inserted) {
+                // Keep the table at most 70% used, counting tombstones
+                // Tombstone을 포함해 table 사용률을 최대 70%로 유지
+                if ((count + tombstones + 1) * 10 > buckets.size() * 7) {
+                    rehash(count * 2 + 16);
+                    index = locate(key);
+                }
+                Bucket& bucket = buckets[index];
+                if (bucket.tombstone) {
+                    bucket.tombstone = false;
+                    --tombstones;
+                }
+                bucket.key = key;
+                bucket.entry.emplace();
+                ++count;
+            }
+            return *buckets[index].entry;
+        }
+
+        void erase(const Key& key) {
+            std::size_t index = locate(key);
+            Bucket& bucket = buckets[index];
+            if (bucket.entry) {
+                bucket.entry.reset();
+                bucket.tombstone = true;
+                --count;
+                ++tombstones;
+            }
+        }
+
+        std::size_t size() const {
+            return count;
+        }
+
+    private:
+        struct Bucket {
+            Key key{};
+            std::optional<Entry> entry;
+            bool tombstone = false; // Erased; probing continues past it
+                                    // 삭제됨; probing은 이 bucket을 지나 계속됨
+        };
+
+        std::vector<Bucket> buckets; // Size is a power of two
+                                     // 크기는 2의 거듭제곱
+        std::size_t count = 0;
+        std::size_t tombstones = 0;
+
+        std::size_t home(const Key& key) const {
+            std::uint64_t mixed = static_cast<std::uint64_t>(std::hash<Key>()(key)) * 0x9E3779B97F4A7C15ull;
+            return static_cast<std::size_t>(mixed ^ (mixed >> 32)) & (buckets.size() - 1);
+        }
+
+        // Bucket holding key, or the bucket where it should be inserted
+        // Key를 가진 bucket, 또는 key를 넣어야 할 bucket
+        std::size_t locate(const Key& key) const {
+            std::size_t mask = buckets.size() - 1;
+            std::size_t index = home(key);
+            std::size_t firstTombstone = buckets.size();
+            while (true) {
+                const Bucket& bucket = buckets[index];
+                if (bucket.entry) {
+                    if (bucket.key == key) {
+                        return index;
+                    }
+                } else if (bucket.tombstone) {
+                    if (firstTombstone == buckets.size()) {
+                        firstTombstone = index;
+                    }
+                } else {
+                    return firstTombstone != buckets.size() ? firstTombstone : index;
+                }
+                index = (index + 1) & mask;
+            }
+        }
+
+        void rehash(std::size_t minimum) {
+            std::size_t capacity = 16;
+            while (capacity * 7 < minimum * 10) {
+                capacity <<= 1;
+            }
+            std::vector<Bucket> old(capacity);
+            old.swap(buckets);
+            tombstones = 0;
+            for (Bucket& bucket : old) {
+                if (bucket.entry) {
+                    std::size_t index = locate(bucket.key);
+                    buckets[index].key = bucket.key;
+                    buckets[index].entry = std::move(bucket.entry);
+                }
+            }
+        }
+    };
+};
+
+// Ordered tree (std::map), the storage of the original GpioPin multiton
+// 정렬된 tree (std::map), 기존 GpioPin multiton의 storage
+struct MapStorage {
+    template<typename Key, typename Entry>
+    class Store {
+    public:
+        Entry* find(const Key& key) {
+            auto found = entries.find(key);
+            return found == entries.end() ? nullptr : &found->second;
+        }
+
+        Entry& findOrInsert(const Key& key, bool& inserted) {
+            auto result = entries.try_emplace(key);
+            inserted = result.second;
+            return result.first->second;
+        }
+
+        void erase(const Key& key) {
+            entries.erase(key);
+        }
+
+        std::size_t size() const {
+            return entries.size();
+        }
+
+    private:
+        std::map<Key, Entry> entries;
+    };
+};
+
+// Eviction policies: when an instance is destroyed
+// Eviction policy: instance가 언제 파괴되는지
+//
+// Each policy provides Cache<Key, T, StoragePolicy> with a Handle type,
+// Handle get(const Key&) and std::size_t size() const. T is constructed
+// from the key on first use, before its entry is added, so a constructor that
+// throws leaves the multiton as it was and the next get() tries again.
+// 각 policy는 Handle type, Handle get(const Key&), std::size_t size() const를 가진
+// Cache<Key, T, StoragePolicy>를 제공함. T는 처음 사용할 때 entry가 추가되기 전에 key로
+// 생성되므로, constructor가 throw해도 multiton은 그대로이며 다음 get()이 다시 시도함.
+
+// Keep every instance until the multiton is destroyed
+// Multiton이 파괴될 때까지 모든 instance를 유지
+struct NeverEvict {
+    template<typename Key, typename T, typename StoragePolicy>
+    class Cache {
+    public:
+        using Handle = T&;
+
+        T& get(const Key& key) {
+            if (Entry* entry = store.find(key)) {
+                return *entry->instance;
+            }
+            std::unique_ptr<T> instance(new T(key));
+            bool inserted;
+            Entry& entry = store.findOrInsert(key, inserted);
+            entry.instance = std::move(instance);
+            return *entry.instance;
+        }
+
+        std::size_t size() const {
+            return store.size();
+        }
+
+    private:
+        struct Entry {
+            std::unique_ptr<T> instance;
+        };
+
+        typename StoragePolicy::template Store<Key, Entry> store;
+    };
+};
+
+// Keep at most capacity instances, dropping the least recently used
+// 최대 capacity개의 instance를 유지하며, 가장 오래 사용되지 않은 것을 제거
+//
+// Handles are shared_ptrs, so an evicted instance lives on until its last
+// user lets go; the next get() of that key creates a new one.
+// Handle은 shared_ptr이므로 제거된 instance는 마지막 사용자가 놓을 때까지 유지되며,
+// 그 key를 다음에 get()하면 새로 생성됨.
+struct LruEvict {
+    template<typename Key, typename T, typename StoragePolicy>
+    class Cache {
+    public:
+        using Handle = std::shared_ptr<T>;
+
+        explicit Cache(std::size_t maxInstances = 1024) : capacity(maxInstances == 0 ? 1 : maxInstances) {}
+
+        Handle get(const Key& key) {
+            if (Entry* entry = store.find(key)) {
+                order.splice(order.begin(), order, entry->position); // Most recent first
+                                                                     // 가장 최근 것이 앞
+                return entry->instance;
+            }
+            Handle instance = std::make_shared<T>(key);
+            bool inserted;
+            Entry& entry = store.findOrInsert(key, inserted);
+            entry.instance = instance;
+            order.push_front(key);
+            entry.position = order.begin();
+            if (store.size() > capacity) {
+                Key victim = order.back();
+                order.pop_back();
+                store.erase(victim);
+            }
+            return instance;
+        }
+
+        std::size_t size() const {
+            return store.size();
+        }
+
+    private:
+        struct Entry {
+            Handle instance;
+            typename std::list<Key>::iterator position;
+        };
+
+        typename StoragePolicy::template Store<Key, Entry> store;
+        std::list<Key> order; // Keys from most to least recently used
+                              // 최근 사용 순서의 key
+        std::size_t capacity;
+    };
+};
+
+// Destroy an instance, and forget its key, when the last handle is released
+// 마지막 handle이 해제되면 instance를 파괴하고 key를 제거
+//
+// The multiton must outlive every handle it gave out.
+// Multiton은 자신이 내준 모든 handle보다 오래 살아야 함.
+struct RefCountEvict {
+    template<typename Key, typename T, typename StoragePolicy>
+    class Cache {
+    public:
+        using Handle = std::shared_ptr<T>;
+
+        Cache() = default;
+        Cache(const Cache&) = delete;
+        Cache& operator=(const Cache&) = delete;
+
+        Handle get(const Key& key) {
+            Entry* found = store.find(key);
+            if (found != nullptr) {
+                if (Handle instance = found->instance.lock()) {
+                    return instance;
+                }
+            }
+            Handle instance(new T(key), Release{this, key});
+            bool inserted;
+            store.findOrInsert(key, inserted).instance = instance;
+            return instance;
+        }
+
+        std::size_t size() const {
+            return store.size();
+        }
+
+    private:
+        struct Entry {
+            std::weak_ptr<T> instance;
+        };
+
+        // Deleter of every handle: destroy the instance and drop its entry
+        // 모든 handle의 deleter: instance를 파괴하고 entry를 제거
+        struct Release {
+            Cache* cache;
+            Key key;
+
+            void operator()(T* instance) const {
+                delete instance;
+                Entry* entry = cache->store.find(key);
+                if (entry != nullptr && entry->instance.expired()) {
+                    cache->store.erase(key);
+                }
+            }
+        };
+
+        typename StoragePolicy::template Store<Key, Entry> store;
+    };
+};
+
+// Multiton with pluggable storage and eviction
+// Storage와 eviction을 교체할 수 있는 multiton
+//
+// get(key) returns the one instance for key, constructing T(key) on first
+// use. Like SystemTimer<TimePolicy> in ex85, the behaviour is chosen at
+// compile time through policy classes, so there is no virtual dispatch. A
+// Multiton is not synchronized; share one between threads behind a mutex.
+// get(key)는 key에 대한 유일한 instance를 반환하며, 처음 사용할 때 T(key)를 생성함.
+// ex85의 SystemTimer<TimePolicy>처럼 동작은 compile 시점에 policy class로 선택되므로
+// virtual dispatch가 없음. Multiton은 동기화되지 않으므로 thread 간에 공유하려면
+// mutex로 보호해야 함.
+template<typename Key, typename T, typename StoragePolicy = MapStorage, typename EvictionPolicy = NeverEvict>
+class Multiton {
+public:
+    using Cache = typename EvictionPolicy::template Cache<Key, T, StoragePolicy>;
+    using Handle = typename Cache::Handle;
+
+    // Arguments go to the eviction policy, e.g. the LRU capacity
+    // 인자는 eviction policy로 전달됨, 예: LRU capacity
+    template<typename... Args>
+    explicit Multiton(Args&&... args) : cache(std::forward<Args>(args)...) {}
+
+    Multiton(const Multiton&) = delete;
+    Multiton& operator=(const Multiton&) = delete;
+
+    Handle get(const Key& key) {
+        return cache.get(key);
+    }
+
+    // Number of keys currently holding an instance
+    // 현재 instance를 가진 key 수
+    std::size_t size() const {
+        return cache.size();
+    }
+
+private:
+    Cache cache;
+};
+
+#endif // EX84_MULTITON_H
@@ -2,114 +2,8 @@
 #include <chrono>
 #include <thread>
 
-// X86 Platform Time Policy
-// X86 플랫폼 시간 정책
-// Uses std::chrono for time measurement (standard C++ library)
-// 시간 측정을 위해 std::chrono 사용 (표준 C++ 라이브러리)
-struct X86TimePolicy {
-    // Initialize time system (not needed for x86)
-    // 시간 시스템 초기화 (x86에서는 불필요)
-    static void init() {
-        std::cout << "[X86] Time system initialized (using std::chrono)" << std::endl;
-    }
-
-    // Get current time in milliseconds
-    // 현재 시간을 밀리초 단위로 얻기
-    static uint32_t getMilliseconds() {
-        using namespace std::chrono;
-        auto now = steady_clock::now();
-        auto ms = duration_cast<milliseconds>(now.time_since_epoch()).count();
-        return static_cast<uint32_t>(ms);
-    }
-
-    // Delay for specified milliseconds
-    // 지정된 밀리초 동안 지연
-    static void delay(uint32_t ms) {
-        std::cout << "[X86] Delaying " << ms << "ms using std::this_thread::sleep_for" << std::endl;
-        std::this_thread::sleep_for(std::chrono::milliseconds(ms));
-    }
-};
-
-// Embedded Platform Time Policy
-// 임베디드 플랫폼 시간 정책
-// Simulates hardware timer (SysTick) for embedded systems
-// 임베디드 시스템을 위한 하드웨어 타이머(SysTick) 시뮬레이션
-struct EmbeddedTimePolicy {
-    // Simulated SysTick counter (in real hardware, this is updated by interrupt)
-    // 시뮬레이션된 SysTick 카운터 (실제 하드웨어에서는 인터럽트로 업데이트됨)
-    static uint32_t systick_counter;
-
-    // Initialize SysTick timer (simulated)
-    // SysTick 타이머 초기화 (시뮬레이션)
-    static void init() {
-        std::cout << "[Embedded] SysTick timer initialized" << std::endl;
-        std::cout << "[Embedded] Timer configured for 1ms tick" << std::endl;
-        systick_counter = 0;
-    }
-
-    // Get current time in milliseconds from SysTick counter
-    // SysTick 카운터에서 현재 시간을 밀리초 단위로 얻기
-    static uint32_t getMilliseconds() {
-        // In real embedded system: return systick_counter;
-        // 실제 임베디드 시스템: return systick_counter;
-        // For simulation, we use chrono but pretend it's a hardware register
-        // 시뮬레이션을 위해 chrono를 사용하지만 하드웨어 레지스터인 척함
-        using namespace std::chrono;
-        auto now = steady_clock::now();
-        auto ms = duration_cast<milliseconds>(now.time_since_epoch()).count();
-        return static_cast<uint32_t>(ms);
-    }
-
-    // Delay using busy-wait loop (typical for embedded systems)
-    // 바쁜 대기 루프를 사용한 지연 (임베디드 시스템에 전형적)
-    static void delay(uint32_t ms) {
-        std::cout << "[Embedded] Delaying " << ms << "ms using busy-wait loop" << std::endl;
-        uint32_t start = getMilliseconds();
-        // Busy-wait loop (polling)
-        // 바쁜 대기 루프 (폴링)
-        while (getMilliseconds() - start < ms) {
-            // In real hardware: __NOP() or WFI() instruction
-            // 실제 하드웨어: __NOP() 또는 WFI() 명령어
-        }
-    }
-};
-
-// Initialize static member
-// 정적 멤버 초기화
-uint32_t EmbeddedTimePolicy::systick_counter = 0;
-
-// System Timer class template with Policy-Based Design
-// Policy-Based Design을 사용하는 시스템 타이머 클래스 템플릿
-template<typename TimePolicy>
-class SystemTimer {
-public:
-    // Initialize the timer system
-    // 타이머 시스템 초기화
-    static void initialize() {
-        TimePolicy::init();
-    }
-
-    // Get current time in milliseconds
-    // 현재 시간을 밀리초 단위로 얻기
-    static uint32_t millis() {
-        return TimePolicy::getMilliseconds();
-    }
-
-    // Delay for specified milliseconds
-    // 지정된 밀리초 동안 지연
-    static void delayMs(uint32_t ms) {
-        TimePolicy::delay(ms);
-    }
-
-    // Measure elapsed time for a task
-    // 작업의 경과 시간 측정
-    static uint32_t measureElapsed(void (*task)()) {
-        uint32_t start = millis();
-        task();
-        uint32_t end = millis();
-        return end - start;
-    }
-};
+#include "system_timer.h"
+#include "timer_wheel.h"
 
 // Application code that works on both platforms
 // 두 플랫폼 모두에서 작동하는 애플리케이션 코드
@@ -184,6 +78,93 @@ int main() {
     taskTime = SystemTimer<EmbeddedTimePolicy>::measureElapsed(sampleTask);
     std::cout << "\n>>> Task execution time: " << taskTime << "ms" << std::endl;
 
+    std::cout << "\n========================================\n" << std::endl;
+
+    // Example 3: High-resolution policies and duration-returning measurement
+    // 예제 3: 고해상도 정책과 duration을 반환하는 측정
+    std::cout << "*** Example 3: High-Resolution Timing ***\n" << std::endl;
+
+    SystemTimer<NanosecondTimePolicy>::initialize();
+    SystemTimer<TscTimePolicy>::initialize();
+
+    // The millisecond overload cannot resolve a sub-millisecond task
+    // 밀리초 overload는 1ms 미만의 작업을 구분하지 못함
+    taskTime = SystemTimer<NanosecondTimePolicy>::measureElapsed(sampleTask);
+    std::cout << "\n>>> Task execution time (ms overload): " << taskTime << "ms" << std::endl;
+
+    auto steadyTime = SystemTimer<NanosecondTimePolicy>::measureElapsed<std::chrono::microseconds>(sampleTask);
+    std::cout << ">>> Task execution time (steady_clock): " << steadyTime.count() << "us" << std::endl;
+
+    auto tscTime = SystemTimer<TscTimePolicy>::measureElapsed<std::chrono::nanoseconds>(sampleTask);
+    std::cout << ">>> Task execution time (TSC): " << tscTime.count() << "ns" << std::endl;
+
+    // Any callable, with arguments
+    // 인자를 받는 임의의 callable
+    auto sumTo = [](int n) {
+        volatile long sum = 0;
+        for (int i = 0; i < n; i++) {
+            sum += i;
+        }
+    };
+    auto lambdaTime = SystemTimer<TscTimePolicy>::measureElapsed<std::chrono::duration<double, std::micro>>(sumTo, 1000);
+    std::cout << ">>> Lambda with argument (TSC): " << lambdaTime.count() << "us" << std::endl;
+
+    // Example 4: Accurate short delays without holding a core
+    // 예제 4: core를 점유하지 않는 정확한 짧은 지연
+    std::cout << "\n*** Example 4: Hybrid Sleep-then-Spin Delay ***\n" << std::endl;
+
+    SystemTimer<HybridTimePolicy>::initialize();
+    auto sleepDelay = SystemTimer<NanosecondTimePolicy>::measureElapsed<std::chrono::microseconds>([]() {
+        SystemTimer<NanosecondTimePolicy>::delayFor(std::chrono::microseconds(250));
+    });
+    auto hybridDelay = SystemTimer<NanosecondTimePolicy>::measureElapsed<std::chrono::microseconds>([]() {
+        SystemTimer<HybridTimePolicy>::delayFor(std::chrono::microseconds(250));
+    });
+    std::cout << ">>> 250us delay, sleep_for in whole ms: " << sleepDelay.count() << "us" << std::endl;
+    std::cout << ">>> 250us delay, hybrid: " << hybridDelay.count() << "us" << std::endl;
+
+    // Example 5: Blink and sensor timeout as timers instead of blocking delays
+    // 예제 5: blocking 지연 대신 timer로 처리하는 LED 깜빡임과 센서 타임아웃
+    std::cout << "\n*** Example 5: Timing Wheel ***" << std::endl;
+
+    TimerWheel<HybridTimePolicy> wheel;
+    auto stamp = [&wheel]() {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(wheel.elapsed()).count();
+    };
+
+    // The LED toggles every 500ms while the sensor reads run in between
+    // 센서 읽기가 진행되는 동안 LED는 500ms마다 토글됨
+    bool ledOn = false;
+    TimerId blink;
+    blink = wheel.schedulePeriodic(std::chrono::milliseconds(500), [&]() {
+        ledOn = !ledOn;
+        std::cout << "[" << stamp() << "ms] >>> LED " << (ledOn ? "ON" : "OFF") << std::endl;
+        if (!ledOn) {
+            wheel.cancel(blink);
+        }
+    });
+
+    // A sensor read arms a 100ms timeout; the data-ready timer cancels it
+    // 센서 읽기는 100ms 타임아웃을 설정하며, data-ready timer가 이를 취소함
+    auto readSensor = [&](std::chrono::milliseconds responseTime) {
+        std::cout << "[" << stamp() << "ms] >>> Reading sensor..." << std::endl;
+        auto start = stamp();
+        TimerId timeout = wheel.scheduleOnce(std::chrono::milliseconds(100), [&stamp]() {
+            std::cout << "[" << stamp() << "ms] >>> Sensor timeout" << std::endl;
+        });
+        wheel.scheduleOnce(responseTime, [&stamp, &wheel, timeout, start]() {
+            if (wheel.cancel(timeout)) {
+                std::cout << "[" << stamp() << "ms] >>> Sensor read completed in " << stamp() - start << "ms"
+                          << std::endl;
+            }
+        });
+    };
+    wheel.scheduleOnce(std::chrono::milliseconds(200), [&]() { readSensor(std::chrono::milliseconds(60)); });
+    wheel.scheduleOnce(std::chrono::milliseconds(600), [&]() { readSensor(std::chrono::milliseconds(150)); });
+
+    wheel.runFor(std::chrono::milliseconds(1050));
+    std::cout << ">>> Pending timers: " << wheel.size() << std::endl;
+
     std::cout << "\n========================================" << std::endl;
     std::cout << "Platform-independent application code!" << std::endl;
     std::cout << "Same logic runs on X86 and Embedded" << std::endl;
@@ -0,0 +1,349 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <time.h>
+
+#include "benchmark.h"
+#include "instrument.h"
+#include "system_timer.h"
+#include "timer_wheel.h"
+
+// Clock reads for the resolution measurement
+// Resolution 측정에 사용하는 clock 읽기 횟수
+constexpr int kReads = 1000000;
+
+// Pending timers in the timing wheel rows, and how long the live run lasts
+// Timing wheel 행의 대기 timer 수와 실시간 실행 길이
+constexpr int kTimers = 100000;
+constexpr auto kWheelRun = std::chrono::seconds(2);
+
+// Smallest non-zero step between two consecutive reads, in nanoseconds
+// 연속된 두 읽기 사이의 0이 아닌 가장 작은 차이 (나노초)
+template<typename Read>
+double resolution(Read read, double unitNs) {
+    std::uint64_t smallest = ~std::uint64_t(0);
+    std::uint64_t previous = read();
+    for (int i = 0; i < kReads; ++i) {
+        std::uint64_t now = read();
+        if (now != previous && now - previous < smallest) {
+            smallest = now - previous;
+        }
+        previous = now;
+    }
+    return static_cast<double>(smallest) * unitNs;
+}
+
+// Thread CPU time in nanoseconds
+// Thread CPU 시간 (나노초)
+std::uint64_t cpuNanoseconds() {
+    timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return static_cast<std::uint64_t>(ts.tv_sec) * 1000000000ull + static_cast<std::uint64_t>(ts.tv_nsec);
+}
+
+// Delay the same interval repeatedly; print the error distribution and CPU use
+// 같은 간격을 반복해서 지연; 오차 분포와 CPU 사용량을 출력
+//
+// The error is actual minus requested time, so a negative value would mean the
+// delay returned early. CPU % is the thread's CPU time over the wall time.
+// 오차는 실제 시간에서 요청한 시간을 뺀 값이므로, 음수는 지연이 일찍 끝났다는 뜻임.
+// CPU %는 wall time 대비 thread의 CPU 시간임.
+template<typename Delay>
+void delayRow(const char* name, std::uint64_t requestNs, Delay delay) {
+    // About 0.3 s per row, with at least 5 and at most 500 delays
+    // 행마다 약 0.3초, 최소 5번에서 최대 500번 지연
+    int repeats = static_cast<int>(std::clamp<std::uint64_t>(300000000 / requestNs, 5, 500));
+    std::vector<double> errorsUs;
+    errorsUs.reserve(static_cast<std::size_t>(repeats));
+
+    std::uint64_t cpuStart = cpuNanoseconds();
+    std::uint64_t wallStart = NanosecondTimePolicy::getNanoseconds();
+    for (int i = 0; i < repeats; ++i) {
+        std::uint64_t start = NanosecondTimePolicy::getNanoseconds();
+        delay(requestNs);
+        std::uint64_t elapsed = NanosecondTimePolicy::getNanoseconds() - start;
+        errorsUs.push_back((static_cast<double>(elapsed) - static_cast<double>(requestNs)) / 1000.0);
+    }
+    double wall = static_cast<double>(NanosecondTimePolicy::getNanoseconds() - wallStart);
+    double cpu = static_cast<double>(cpuNanoseconds() - cpuStart);
+
+    std::sort(errorsUs.begin(), errorsUs.end());
+    auto at = [&errorsUs](double q) {
+        return errorsUs[static_cast<std::size_t>(q * static_cast<double>(errorsUs.size() - 1))];
+    };
+    std::cout << std::setw(10) << (requestNs >= 1000000 ? std::to_string(requestNs / 1000000) + "ms"
+                                                        : std::to_string(requestNs / 1000) + "us")
+              << std::setw(12) << name << std::fixed << std::setprecision(1)
+              << std::setw(10) << errorsUs.front() << std::setw(10) << at(0.50)
+              << std::setw(10) << at(0.99) << std::setw(10) << errorsUs.back()
+              << std::setw(8) << cpu / wall * 100.0 << "%" << std::setw(8) << repeats << std::endl;
+}
+
+template<typename TimePolicy, typename Read>
+void printRow(const char* name, Read read, double unitNs) {
+    // A 200us busy task that the old millisecond measurement reports as 0
+    // 기존 밀리초 측정이 0으로 보고하는 200us busy 작업
+    auto task = []() {
+        auto end = std::chrono::steady_clock::now() + std::chrono::microseconds(200);
+        while (std::chrono::steady_clock::now() < end) {
+        }
+    };
+    auto measured = SystemTimer<TimePolicy>::template measureElapsed<std::chrono::duration<double, std::micro>>(task);
+
+    std::cout << std::setw(12) << name << std::fixed << std::setprecision(2)
+              << std::setw(16) << resolution(read, unitNs)
+              << std::setw(14) << measured.count() << std::endl;
+}
+
+// The same small body with and without each INSTRUMENT_* macro
+// 각 INSTRUMENT_* macro가 있을 때와 없을 때의 같은 작은 본문
+__attribute__((noinline)) std::uint64_t plainCall(std::uint64_t x) {
+    return x * 2654435761u;
+}
+
+__attribute__((noinline)) std::uint64_t scopedCall(std::uint64_t x) {
+    INSTRUMENT_SCOPE("scopedCall");
+    return x * 2654435761u;
+}
+
+__attribute__((noinline)) std::uint64_t countedCall(std::uint64_t x) {
+    INSTRUMENT_COUNT("countedCall", 1);
+    return x * 2654435761u;
+}
+
+__attribute__((noinline)) std::uint64_t valueCall(std::uint64_t x) {
+    INSTRUMENT_VALUE("valueCall", x & 1023);
+    return x * 2654435761u;
+}
+
+// Percentile of an already sorted vector
+// 이미 정렬된 vector의 백분위수
+double percentile(const std::vector<double>& sorted, double q) {
+    return sorted[static_cast<std::size_t>(q * static_cast<double>(sorted.size() - 1))];
+}
+
+// Run kTimers live timers on a 1ms wheel for kWheelRun and print firing jitter and per-tick cost
+// 1ms wheel에서 kTimers개의 timer를 kWheelRun 동안 실행하고 실행 jitter와 tick당 비용을 출력
+//
+// Four in five timers are periodic with a period of 10-1000ms; the rest are
+// one-shots that re-arm themselves with a new 1-1000ms delay, so the wheel
+// also schedules from inside callbacks. Jitter is how long after its tick
+// boundary a callback ran: the wake-up error plus the callbacks that ran
+// before it in the same tick. The driver loop is runFor() with timing added.
+// 다섯 중 넷은 주기가 10-1000ms인 주기적 timer이고, 나머지는 새 1-1000ms 지연으로 스스로를
+// 다시 예약하는 one-shot이므로 wheel은 callback 안에서도 schedule함. Jitter는 callback이
+// 자신의 tick 경계보다 얼마나 늦게 실행되었는지로, 깨어나는 오차에 같은 tick에서 먼저 실행된
+// callback들의 시간이 더해진 값임. Driver loop는 측정을 추가한 runFor()임.
+void wheelRun() {
+    TimerWheel<HybridTimePolicy> wheel(std::chrono::milliseconds(1));
+    const std::uint64_t tickNs = static_cast<std::uint64_t>(wheel.tickDuration().count());
+    std::mt19937 rng(85);
+    std::uniform_int_distribution<int> periodMs(10, 1000);
+    std::uniform_int_distribution<int> delayMs(1, 1000);
+
+    std::vector<double> jitterUs;
+    jitterUs.reserve(2000000);
+    auto recordJitter = [&wheel, &jitterUs, tickNs]() {
+        std::uint64_t lateNs = static_cast<std::uint64_t>(wheel.elapsed().count()) -
+                               wheel.currentTickProcessed() * tickNs;
+        jitterUs.push_back(static_cast<double>(lateNs) / 1000.0);
+    };
+    std::function<void()> oneShot = [&]() {
+        recordJitter();
+        wheel.scheduleOnce(std::chrono::milliseconds(delayMs(rng)), oneShot);
+    };
+    for (int i = 0; i < kTimers; ++i) {
+        if (i % 5 == 4) {
+            wheel.scheduleOnce(std::chrono::milliseconds(delayMs(rng)), oneShot);
+        } else {
+            wheel.schedulePeriodic(std::chrono::milliseconds(periodMs(rng)), recordJitter);
+        }
+    }
+
+    std::vector<double> tickCostUs;
+    std::uint64_t pollNs = 0;
+    std::size_t fired = 0;
+    std::uint64_t cpuStart = cpuNanoseconds();
+    std::uint64_t wallStart = NanosecondTimePolicy::getNanoseconds();
+    std::uint64_t endNs = static_cast<std::uint64_t>(
+        (wheel.elapsed() + std::chrono::duration_cast<std::chrono::nanoseconds>(kWheelRun)).count());
+    for (;;) {
+        std::uint64_t tickBefore = wheel.currentTickProcessed();
+        std::uint64_t start = NanosecondTimePolicy::getNanoseconds();
+        fired += wheel.poll();
+        std::uint64_t cost = NanosecondTimePolicy::getNanoseconds() - start;
+        std::uint64_t ticks = wheel.currentTickProcessed() - tickBefore;
+        if (ticks > 0) {
+            pollNs += cost;
+            tickCostUs.push_back(static_cast<double>(cost) / static_cast<double>(ticks) / 1000.0);
+        }
+        std::uint64_t nowNs = static_cast<std::uint64_t>(wheel.elapsed().count());
+        if (nowNs >= endNs) {
+            break;
+        }
+        SystemTimer<HybridTimePolicy>::delayFor(std::chrono::nanoseconds((nowNs / tickNs + 1) * tickNs - nowNs));
+    }
+    double wall = static_cast<double>(NanosecondTimePolicy::getNanoseconds() - wallStart);
+    double cpu = static_cast<double>(cpuNanoseconds() - cpuStart);
+
+    std::sort(jitterUs.begin(), jitterUs.end());
+    std::sort(tickCostUs.begin(), tickCostUs.end());
+    std::cout << "\nTiming wheel, " << kTimers << " timers on a 1ms tick for "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(kWheelRun).count() << "ms: " << fired
+              << " callbacks in " << tickCostUs.size() << " polls, " << std::fixed << std::setprecision(1)
+              << cpu / wall * 100.0 << "% CPU" << std::endl;
+    std::cout << std::setw(22) << "us" << std::setw(10) << "min" << std::setw(10) << "p50" << std::setw(10)
+              << "p99" << std::setw(10) << "max" << std::endl;
+    std::cout << std::setw(22) << "firing jitter" << std::setw(10) << jitterUs.front() << std::setw(10)
+              << percentile(jitterUs, 0.50) << std::setw(10) << percentile(jitterUs, 0.99) << std::setw(10)
+              << jitterUs.back() << std::endl;
+    std::cout << std::setw(22) << "poll cost per tick" << std::setw(10) << tickCostUs.front() << std::setw(10)
+              << percentile(tickCostUs, 0.50) << std::setw(10) << percentile(tickCostUs, 0.99) << std::setw(10)
+              << tickCostUs.back() << std::endl;
+    std::cout << "Poll cost per callback: " << static_cast<double>(pollNs) / static_cast<double>(fired)
+              << "ns, including the callback's clock read" << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    auto bench = Benchmark<>::fromArgs(argc, argv);
+
+    std::cout.setstate(std::ios::badbit); // Silence the policies' init messages
+                                          // Policy init 메시지를 숨김
+    SystemTimer<TscTimePolicy>::initialize();
+    std::cout.clear();
+
+    auto readMilliseconds = []() { return std::uint64_t(X86TimePolicy::getMilliseconds()); };
+    auto readNanoseconds = []() { return NanosecondTimePolicy::getNanoseconds(); };
+    auto readTsc = []() { return TscTimePolicy::getNanoseconds(); };
+
+    bench.section("Clock read cost, ns per read");
+    bench.run("x86 (ms)", [&]() { doNotOptimize(readMilliseconds()); });
+    bench.run("nanosecond", [&]() { doNotOptimize(readNanoseconds()); });
+    bench.run("tsc", [&]() { doNotOptimize(readTsc()); });
+
+    // Resolution, a single timed task and drift are one-off readings, printed in table format only
+    // Resolution, 한 번 측정한 작업, drift는 단일 값이므로 table 형식에서만 출력됨
+    if (bench.reportFormat() == ReportFormat::Table) {
+        std::cout << "\nResolution and a 200us task measured by each policy" << std::endl;
+        std::cout << std::setw(12) << "policy" << std::setw(16) << "resolution ns" << std::setw(14) << "200us task"
+                  << std::endl;
+        printRow<X86TimePolicy>("x86 (ms)", readMilliseconds, 1e6);
+        printRow<NanosecondTimePolicy>("nanosecond", readNanoseconds, 1.0);
+        printRow<TscTimePolicy>("tsc", readTsc, 1.0);
+
+        // Drift of the calibrated counter from steady_clock
+        // 보정된 counter와 steady_clock 사이의 drift
+        std::uint64_t steadyStart = NanosecondTimePolicy::getNanoseconds();
+        std::uint64_t tscStart = TscTimePolicy::getNanoseconds();
+        std::this_thread::sleep_for(std::chrono::milliseconds(500));
+        double steadyElapsed = static_cast<double>(NanosecondTimePolicy::getNanoseconds() - steadyStart);
+        double tscElapsed = static_cast<double>(TscTimePolicy::getNanoseconds() - tscStart);
+        std::cout << std::endl << "TSC vs steady_clock over 500ms: " << std::setprecision(1)
+                  << (tscElapsed - steadyElapsed) / 1000.0 << "us ("
+                  << std::setprecision(0) << (tscElapsed - steadyElapsed) / steadyElapsed * 1e6 << " ppm)" << std::endl;
+
+        // Delay accuracy: sleep_for (X86TimePolicy), busy-wait (EmbeddedTimePolicy) and hybrid,
+        // all at nanosecond granularity so only the waiting strategy differs
+        // 지연 정확도: sleep_for (X86TimePolicy), busy-wait (EmbeddedTimePolicy), hybrid를
+        // 모두 나노초 단위로 요청하여 대기 방식만 다르게 함
+        std::cout.setstate(std::ios::badbit);
+        SystemTimer<HybridTimePolicy>::initialize();
+        std::cout.clear();
+        std::cout << "\nDelay error (us, actual - requested) and CPU use; hybrid spins for the last "
+                  << HybridTimePolicy::spinThreshold / 1000 << "us" << std::endl;
+        std::cout << std::setw(10) << "delay" << std::setw(12) << "method" << std::setw(10) << "min"
+                  << std::setw(10) << "p50" << std::setw(10) << "p99" << std::setw(10) << "max"
+                  << std::setw(9) << "CPU" << std::setw(8) << "delays" << std::endl;
+        auto sleepDelay = [](std::uint64_t ns) {
+            std::this_thread::sleep_for(std::chrono::nanoseconds(ns));
+        };
+        auto busyDelay = [](std::uint64_t ns) {
+            std::uint64_t deadline = NanosecondTimePolicy::getNanoseconds() + ns;
+            while (NanosecondTimePolicy::getNanoseconds() < deadline) {
+            }
+        };
+        auto hybridDelay = [](std::uint64_t ns) {
+            HybridTimePolicy::delayNanoseconds(ns);
+        };
+        for (std::uint64_t requestNs : {10000ull, 100000ull, 1000000ull, 10000000ull, 100000000ull}) {
+            delayRow("sleep_for", requestNs, sleepDelay);
+            delayRow("busy-wait", requestNs, busyDelay);
+            delayRow("hybrid", requestNs, hybridDelay);
+        }
+
+        wheelRun();
+    }
+
+    // Schedule and cancel with kTimers already pending, at delays up to a minute so
+    // every level of the wheel is used; the wheel is never polled, so nothing fires
+    // kTimers개가 이미 대기 중인 상태에서 schedule과 cancel; 지연은 최대 1분이라 wheel의 모든
+    // level이 사용되며, poll하지 않으므로 아무것도 실행되지 않음
+    TimerWheel<NanosecondTimePolicy> wheel(std::chrono::milliseconds(1));
+    std::mt19937 rng(85);
+    std::uniform_int_distribution<int> delayMs(1, 60000);
+    std::vector<std::chrono::milliseconds> delays(kTimers);
+    for (auto& delay : delays) {
+        delay = std::chrono::milliseconds(delayMs(rng));
+    }
+    std::vector<TimerId> ids(kTimers);
+    auto noop = []() {};
+    for (int i = 0; i < kTimers; ++i) {
+        ids[static_cast<std::size_t>(i)] = wheel.scheduleOnce(delays[static_cast<std::size_t>(i)], noop);
+    }
+    std::vector<std::size_t> order(kTimers);
+    for (std::size_t i = 0; i < order.size(); ++i) {
+        order[i] = i;
+    }
+    std::shuffle(order.begin(), order.end(), rng);
+
+    bench.section("Timing wheel with " + std::to_string(kTimers) + " pending timers, ns per operation");
+    std::size_t next = 0;
+    bench.run("schedule + cancel", [&]() {
+        TimerId id = wheel.scheduleOnce(delays[next], noop);
+        doNotOptimize(wheel.cancel(id));
+        next = next + 1 == delays.size() ? 0 : next + 1;
+    });
+    // Cancel all kTimers in random order, then schedule them again
+    // kTimers개를 무작위 순서로 모두 취소한 뒤 다시 schedule
+    bench.run("cancel + reschedule all", [&]() {
+        for (std::size_t i : order) {
+            wheel.cancel(ids[i]);
+        }
+        for (std::size_t i : order) {
+            ids[i] = wheel.scheduleOnce(delays[i], noop);
+        }
+    }, kTimers);
+
+    // Instrumentation compiled in: first disabled, then enabled. The enabled scope
+    // fills its thread's trace buffer within the warm-up, so the rows show the
+    // steady state, where only the histogram is updated.
+    // 계측을 포함하여 compile: 먼저 비활성, 그다음 활성 상태. 활성 scope는 warm-up 중에 thread의
+    // trace buffer를 채우므로, 행은 histogram만 갱신되는 정상 상태를 보여줌.
+    bench.section("Instrumentation overhead, ns per call");
+    std::uint64_t x = 1;
+    auto callRow = [&bench, &x](const char* name, std::uint64_t (*call)(std::uint64_t)) {
+        bench.run(name, [&x, call]() {
+            x = call(x);
+            doNotOptimize(x);
+        });
+    };
+    callRow("no instrumentation", plainCall);
+    callRow("scope, disabled", scopedCall);
+    callRow("counter, disabled", countedCall);
+    callRow("value, disabled", valueCall);
+    Instrument::enable();
+    callRow("scope, enabled", scopedCall);
+    callRow("counter, enabled", countedCall);
+    callRow("value, enabled", valueCall);
+    Instrument::disable();
+
+    bench.report();
+    return 0;
+}
@@ -0,0 +1,355 @@
+#ifndef EX85_TIMER_WHEEL_H
+#define EX85_TIMER_WHEEL_H
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include "system_timer.h"
+
+// Handle to a scheduled timer
+// 예약된 timer의 handle
+//
+// The generation makes a handle to a fired or cancelled timer stale, so
+// cancelling it later is a harmless no-op even after its node is reused.
+// Generation 덕분에 이미 실행되었거나 취소된 timer의 handle은 무효가 되므로, node가
+// 재사용된 뒤에 취소해도 아무 일도 일어나지 않음.
+struct TimerId {
+    std::uint32_t index = ~std::uint32_t(0);
+    std::uint32_t generation = 0;
+};
+
+// Hierarchical Timing Wheel
+// 계층형 timing wheel
+//
+// Runs one-shot and periodic callbacks on the calling thread. Time is cut into
+// ticks of tickDuration; four levels of 256 slots cover 2^32 ticks (about 49
+// days at 1 ms). Level 0 holds timers due within 256 ticks, one slot per tick;
+// level 1 holds timers due within 2^16 ticks, one slot per 256 ticks, and so
+// on. Each time level 0 wraps, the next slot of level 1 is cascaded down, and
+// so on upwards. Timers live in a pool and are linked into their slot by index,
+// so schedule and cancel are O(1) and never touch the other timers.
+// 호출한 thread에서 one-shot과 주기적 callback을 실행함. 시간은 tickDuration 단위의
+// tick으로 나뉘며, 256개 slot짜리 level 4개가 2^32 tick (1 ms 기준 약 49일)을 담당함.
+// Level 0은 256 tick 안에 만료되는 timer를 tick마다 slot 하나씩, level 1은 2^16 tick 안에
+// 만료되는 timer를 256 tick마다 slot 하나씩 담는 식임. Level 0이 한 바퀴 돌 때마다
+// level 1의 다음 slot이 아래로 내려가며 (cascade), 위 level도 같은 방식임. Timer는 pool에
+// 있고 index로 slot에 연결되므로 schedule과 cancel은 O(1)이며 다른 timer를 건드리지 않음.
+//
+// A timer never fires early: its due time is rounded up to the next tick
+// boundary, and periodic timers are re-armed from their previous due tick, so
+// they do not drift when a callback runs late.
+// Timer는 일찍 실행되지 않음: 만료 시간은 다음 tick 경계로 올림되고, 주기적 timer는 이전
+// 만료 tick을 기준으로 다시 예약되므로 callback이 늦게 실행되어도 drift가 생기지 않음.
+template<typename TimePolicy>
+class TimerWheel {
+public:
+    using Callback = std::function<void()>;
+
+    static constexpr int kLevels = 4;
+    static constexpr int kSlotBits = 8;
+    static constexpr std::uint32_t kSlots = 1u << kSlotBits;
+
+    explicit TimerWheel(std::chrono::nanoseconds tickDuration = std::chrono::milliseconds(1))
+        : tickNs(static_cast<std::uint64_t>(tickDuration.count() > 0 ? tickDuration.count() : 1)) {
+        for (auto& level : slots) {
+            level.fill(kNil);
+        }
+        if constexpr (SystemTimer<TimePolicy>::kHighResolution) {
+            originNs = SystemTimer<TimePolicy>::nanos();
+        } else {
+            lastMs = SystemTimer<TimePolicy>::millis();
+        }
+    }
+
+    TimerWheel(const TimerWheel&) = delete;
+    TimerWheel& operator=(const TimerWheel&) = delete;
+
+    // Run callback once, after delay
+    // delay 후 callback을 한 번 실행
+    template<typename Rep, typename Period>
+    TimerId scheduleOnce(std::chrono::duration<Rep, Period> delay, Callback callback) {
+        return add(dueTick(delay), 0, std::move(callback));
+    }
+
+    // Run callback every period, starting one period from now
+    // 지금부터 한 주기 후를 시작으로 period마다 callback을 실행
+    template<typename Rep, typename Period>
+    TimerId schedulePeriodic(std::chrono::duration<Rep, Period> period, Callback callback) {
+        std::uint64_t periodTicks = ceilTicks(period);
+        return add(dueTick(period), periodTicks == 0 ? 1 : periodTicks, std::move(callback));
+    }
+
+    // Cancel a pending timer; returns false if it already fired or was cancelled
+    // 대기 중인 timer를 취소; 이미 실행되었거나 취소되었으면 false를 반환
+    //
+    // A periodic timer may cancel itself from its own callback.
+    // 주기적 timer는 자신의 callback 안에서 스스로를 취소할 수 있음.
+    bool cancel(TimerId id) {
+        if (id.index >= nodes.size()) {
+            return false;
+        }
+        Node& node = nodes[id.index];
+        if (node.generation != id.generation || node.state == State::Free) {
+            return false;
+        }
+        if (node.state == State::Firing) {
+            // The callback is running; poll() frees the node when it returns
+            // Callback이 실행 중이므로, 반환된 뒤 poll()이 node를 해제함
+            node.period = 0;
+            node.state = State::Cancelled;
+            return true;
+        }
+        if (node.state == State::Cancelled) {
+            return false;
+        }
+        unlink(id.index);
+        release(id.index);
+        return true;
+    }
+
+    // Process every tick up to the current time; returns the number of callbacks run
+    // 현재 시간까지의 모든 tick을 처리; 실행한 callback 수를 반환
+    std::size_t poll() {
+        return advanceTo(currentTick());
+    }
+
+    // Poll, then delay to the next tick boundary, until duration has passed
+    // duration이 지날 때까지 poll한 뒤 다음 tick 경계까지 지연하기를 반복
+    //
+    // With HybridTimePolicy each wait ends within a few microseconds of the
+    // boundary; a millisecond policy rounds every wait up to whole milliseconds.
+    // HybridTimePolicy를 사용하면 각 대기는 경계에서 수 마이크로초 안에 끝나며, 밀리초
+    // policy는 모든 대기를 밀리초 단위로 올림함.
+    template<typename Rep, typename Period>
+    void runFor(std::chrono::duration<Rep, Period> duration) {
+        std::uint64_t endNs = elapsedNanoseconds() + static_cast<std::uint64_t>(
+                                  std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count());
+        for (;;) {
+            poll();
+            std::uint64_t nowNs = elapsedNanoseconds();
+            if (nowNs >= endNs) {
+                return;
+            }
+            std::uint64_t nextTickNs = (nowNs / tickNs + 1) * tickNs;
+            SystemTimer<TimePolicy>::delayFor(std::chrono::nanoseconds(std::min(nextTickNs, endNs) - nowNs));
+        }
+    }
+
+    // Number of pending timers
+    // 대기 중인 timer 수
+    std::size_t size() const {
+        return pending;
+    }
+
+    // Last tick processed, counted from construction
+    // 마지막으로 처리한 tick (생성 시점부터 셈)
+    std::uint64_t currentTickProcessed() const {
+        return now;
+    }
+
+    // Time since construction on the TimePolicy clock
+    // TimePolicy clock 기준 생성 후 경과 시간
+    std::chrono::nanoseconds elapsed() {
+        return std::chrono::nanoseconds(elapsedNanoseconds());
+    }
+
+    std::chrono::nanoseconds tickDuration() const {
+        return std::chrono::nanoseconds(tickNs);
+    }
+
+private:
+    static constexpr std::uint32_t kNil = ~std::uint32_t(0);
+    static constexpr std::uint64_t kRange = std::uint64_t(1) << (kLevels * kSlotBits);
+
+    enum class State : std::uint8_t { Free, Pending, Firing, Cancelled };
+
+    struct Node {
+        std::uint64_t due = 0;
+        std::uint64_t period = 0; // Ticks; 0 for a one-shot timer
+        Callback callback;
+        std::uint32_t prev = kNil;
+        std::uint32_t next = kNil; // Next free node while State::Free
+        std::uint32_t* head = nullptr; // Slot this node is linked into
+        std::uint32_t generation = 0;
+        State state = State::Free;
+    };
+
+    // Nanoseconds since construction; millisecond policies extend their 32-bit counter
+    // 생성 후 경과 나노초; 밀리초 policy는 32-bit counter를 확장하여 사용
+    std::uint64_t elapsedNanoseconds() {
+        if constexpr (SystemTimer<TimePolicy>::kHighResolution) {
+            return SystemTimer<TimePolicy>::nanos() - originNs;
+        } else {
+            std::uint32_t ms = SystemTimer<TimePolicy>::millis();
+            elapsedMs += ms - lastMs;
+            lastMs = ms;
+            return elapsedMs * 1000000;
+        }
+    }
+
+    std::uint64_t currentTick() {
+        return elapsedNanoseconds() / tickNs;
+    }
+
+    template<typename Rep, typename Period>
+    std::uint64_t ceilTicks(std::chrono::duration<Rep, Period> duration) const {
+        auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+        return ns <= 0 ? 0 : (static_cast<std::uint64_t>(ns) + tickNs - 1) / tickNs;
+    }
+
+    // First tick boundary at or after now + delay, and always after the last processed tick
+    // now + delay 이후의 첫 tick 경계이며, 항상 마지막으로 처리한 tick보다 뒤임
+    template<typename Rep, typename Period>
+    std::uint64_t dueTick(std::chrono::duration<Rep, Period> delay) {
+        auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(delay).count();
+        std::uint64_t dueNs = elapsedNanoseconds() + static_cast<std::uint64_t>(ns > 0 ? ns : 0);
+        std::uint64_t tick = (dueNs + tickNs - 1) / tickNs;
+        return tick > now ? tick : now + 1;
+    }
+
+    TimerId add(std::uint64_t due, std::uint64_t period, Callback callback) {
+        std::uint32_t index;
+        if (freeHead != kNil) {
+            index = freeHead;
+            freeHead = nodes[index].next;
+        } else {
+            index = static_cast<std::uint32_t>(nodes.size());
+            nodes.emplace_back();
+        }
+        Node& node = nodes[index];
+        node.due = due;
+        node.period = period;
+        node.callback = std::move(callback);
+        node.state = State::Pending;
+        link(index);
+        ++pending;
+        return TimerId{index, node.generation};
+    }
+
+    void release(std::uint32_t index) {
+        Node& node = nodes[index];
+        node.callback = nullptr;
+        node.state = State::Free;
+        ++node.generation;
+        node.next = freeHead;
+        freeHead = index;
+        --pending;
+    }
+
+    // Put a pending node into the slot for its due tick, relative to the current tick
+    // Pending node를 현재 tick 기준 만료 tick에 해당하는 slot에 넣음
+    void link(std::uint32_t index) {
+        Node& node = nodes[index];
+        std::uint64_t delta = node.due - now;
+        // Beyond the wheel's range: park in the farthest top-level slot and re-place on cascade
+        // Wheel 범위를 넘으면 가장 먼 최상위 slot에 두고 cascade 때 다시 배치
+        std::uint64_t due = delta < kRange ? node.due : now + kRange - 1;
+        if (delta >= kRange) {
+            delta = kRange - 1;
+        }
+        int level = 0;
+        while (level < kLevels - 1 && delta >= (std::uint64_t(1) << ((level + 1) * kSlotBits))) {
+            ++level;
+        }
+        std::uint32_t* head = &slots[level][(due >> (level * kSlotBits)) & (kSlots - 1)];
+        node.head = head;
+        node.prev = kNil;
+        node.next = *head;
+        if (*head != kNil) {
+            nodes[*head].prev = index;
+        }
+        *head = index;
+    }
+
+    void unlink(std::uint32_t index) {
+        Node& node = nodes[index];
+        if (node.prev != kNil) {
+            nodes[node.prev].next = node.next;
+        } else {
+            *node.head = node.next;
+        }
+        if (node.next != kNil) {
+            nodes[node.next].prev = node.prev;
+        }
+        node.head = nullptr;
+    }
+
+    // Move every timer of a higher-level slot down to where it now belongs
+    // 상위 level slot의 모든 timer를 현재 속해야 할 위치로 내림
+    void cascade(int level) {
+        std::uint32_t* head = &slots[level][(now >> (level * kSlotBits)) & (kSlots - 1)];
+        std::uint32_t index = *head;
+        *head = kNil;
+        while (index != kNil) {
+            std::uint32_t next = nodes[index].next;
+            link(index);
+            index = next;
+        }
+    }
+
+    std::size_t advanceTo(std::uint64_t target) {
+        std::size_t fired = 0;
+        if (pending == 0 && target > now) {
+            // Nothing to fire: jump straight to the target tick
+            // 실행할 것이 없으면 목표 tick으로 바로 이동
+            now = target;
+            return 0;
+        }
+        while (now < target) {
+            ++now;
+            for (int level = 1; level < kLevels; ++level) {
+                if (((now >> ((level - 1) * kSlotBits)) & (kSlots - 1)) != 0) {
+                    break;
+                }
+                cascade(level);
+            }
+            fired += fireSlot(slots[0][now & (kSlots - 1)]);
+        }
+        return fired;
+    }
+
+    // Run every timer in a level-0 slot; the list stays linked, so a callback may
+    // cancel other timers in the same slot
+    // Level 0 slot의 모든 timer를 실행; list가 연결된 채로 남아 있으므로 callback이 같은
+    // slot의 다른 timer를 취소할 수 있음
+    std::size_t fireSlot(std::uint32_t& head) {
+        std::size_t fired = 0;
+        while (head != kNil) {
+            std::uint32_t index = head;
+            unlink(index);
+            nodes[index].state = State::Firing;
+            // Move the callback out: scheduling from inside it may grow the pool
+            // Callback을 꺼내서 실행: callback 안에서 schedule하면 pool이 커질 수 있음
+            Callback callback = std::move(nodes[index].callback);
+            callback();
+            ++fired;
+            Node& node = nodes[index];
+            if (node.state == State::Firing && node.period != 0) {
+                node.callback = std::move(callback);
+                node.due += node.period;
+                node.state = State::Pending;
+                link(index);
+            } else {
+                release(index);
+            }
+        }
+        return fired;
+    }
+
+    std::vector<Node> nodes;
+    std::array<std::array<std::uint32_t, kSlots>, kLevels> slots;
+    std::uint32_t freeHead = kNil;
+    std::size_t pending = 0;
+    std::uint64_t now = 0; // Last processed tick
+    std::uint64_t tickNs;
+    std::uint64_t originNs = 0;
+    std::uint32_t lastMs = 0;
+    std::uint64_t elapsedMs = 0;
+};
+
+#endif // EX85_TIMER_WHEEL_H